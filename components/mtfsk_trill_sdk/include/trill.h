@@ -22,6 +22,13 @@
  */
 #define TRILL_MAX_RX_CHANNELS	4
 
+/**
+ * @note TRILL_CONFIG_* values below describe how the prebuilt
+ * libtrill_core_sdk.a was built. Editing them has no effect on the library.
+ * Library variant and audio buffer counts are selected in menuconfig
+ * (Trill SDK), the buffer counts are passed in trill_init_opts_t.
+ */
+
 /**
  * @brief Number of audio blocks to allocate for decoder path.
  * Total size of audio buffer will block_size * number of audio blocks.
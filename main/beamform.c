@@ -0,0 +1,572 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "esp_heap_caps.h"
+#include "esp_dsp.h"
+
+#include "app_config.h"
+#include "beamform.h"
+
+// Lagrange interpolator needs delay >= 1 and 4 taps.
+#define BASE_DELAY          1
+#define HIST_N              (APP_BEAM_MAX_LAG + BASE_DELAY + 3)
+#define LAG_DIV             4   // lag grid steps per sample
+#define N_LAG_STEPS         (2 * APP_BEAM_MAX_LAG * LAG_DIV + 1)
+#define XSPEC_EWMA_SHIFT    2   // alpha 1/4, both paths
+#define FLOOR_EWMA_ALPHA    0.02f
+
+static int16_t* line[2];
+static unsigned int block_n;
+static float energy_floor;
+static float seed_floor;
+static float seed_delay;
+static int search_stride = 1;   // lag grid steps, LAG_DIV is integer lags
+static int steer_frozen;
+
+#if APP_BEAM_Q15
+#define Q8_ONE              256
+#define LAGR_FRAC_N         256
+
+static int16_t* fft_buf;    // N complex, sc16
+static int32_t* xspec;      // N/2+1 complex, smoothed conj(X0) * X1
+static int32_t* pspec;      // N/2+1 x 2, smoothed |X0|^2, |X1|^2
+static int16_t* wspec;      // N/2 complex, Q15 coherence
+static int16_t* cos_tab;    // LAG_DIV * N, Q15
+static int16_t lagr_tab[LAGR_FRAC_N][4];    // Q14 taps for delay 1 + f/256
+static int steer_q8;        // samples, Q8
+#else
+static float* fft_buf;      // N complex
+static float* xspec;        // N/2+1 complex, smoothed conj(X0) * X1
+static float* pspec;        // N/2+1 x 2, smoothed |X0|^2, |X1|^2
+static float steer_delay;
+#endif
+
+/* 3rd order Lagrange taps on x[n-i .. n-i-3] for delay i - 1 + d, 1 <= d < 2. */
+static void lagrange_taps(float d, float h[4])
+{
+    h[0] = -(d - 1) * (d - 2) * (d - 3) / 6.0f;
+    h[1] = d * (d - 2) * (d - 3) / 2.0f;
+    h[2] = -d * (d - 1) * (d - 3) / 2.0f;
+    h[3] = d * (d - 1) * (d - 2) / 6.0f;
+}
+
+#if APP_BEAM_Q15
+
+static int alloc_state(unsigned int n_samples)
+{
+    esp_err_t ret;
+    unsigned int n_bins = n_samples / 2 + 1;
+    unsigned int n_phase = LAG_DIV * n_samples;
+
+    ret = dsps_fft2r_init_sc16(NULL, n_samples);
+    if ((ret != ESP_OK) && (ret != ESP_ERR_DSP_REINITIALIZED))
+    {
+        printf("beamform: fft init failed = %d\n", ret);
+        return -1;
+    }
+
+    fft_buf = heap_caps_malloc(2 * n_samples * sizeof(int16_t), MALLOC_CAP_INTERNAL);
+    xspec = heap_caps_calloc(2 * n_bins, sizeof(int32_t), MALLOC_CAP_INTERNAL);
+    pspec = heap_caps_calloc(2 * n_bins, sizeof(int32_t), MALLOC_CAP_INTERNAL);
+    wspec = heap_caps_calloc(2 * n_bins, sizeof(int16_t), MALLOC_CAP_INTERNAL);
+    cos_tab = heap_caps_malloc(n_phase * sizeof(int16_t), MALLOC_CAP_INTERNAL);
+
+    if (!fft_buf || !xspec || !pspec || !wspec || !cos_tab)
+        return -1;
+
+    // Tables are built once here, the per block path is integer only.
+    for (unsigned int j = 0; j < n_phase; j++)
+    {
+        float c = cosf(2.0f * (float) M_PI * j / n_phase);
+        cos_tab[j] = (int16_t) lrintf(fminf(c * 32768.0f, 32767.0f));
+    }
+
+    for (int f = 0; f < LAGR_FRAC_N; f++)
+    {
+        float h[4];
+
+        lagrange_taps(1.0f + (float) f / LAGR_FRAC_N, h);
+        for (int t = 0; t < 4; t++)
+            lagr_tab[f][t] = (int16_t) lrintf(h[t] * 16384.0f);
+    }
+
+    steer_q8 = 0;
+
+    return 0;
+}
+
+static void free_state(void)
+{
+    free(wspec);
+    free(cos_tab);
+    wspec = NULL;
+    cos_tab = NULL;
+}
+
+static uint32_t isqrt32(uint32_t v)
+{
+    uint32_t r = 0;
+    uint32_t bit = 1u << 30;
+
+    while (bit > v)
+        bit >>= 2;
+
+    while (bit)
+    {
+        if (v >= r + bit)
+        {
+            v -= r + bit;
+            r = (r >> 1) + bit;
+        }
+        else
+        {
+            r >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    return r;
+}
+
+static inline int16_t sat_q15(int32_t v)
+{
+    if (v > 32767)
+        return 32767;
+    if (v < -32768)
+        return -32768;
+    return (int16_t) v;
+}
+
+/*
+    As float path, on esp-dsp sc16 FFT (scaled by 1/N). Products are
+    shifted so smoothed spectra and their EWMA step stay within int32.
+*/
+static void xspec_update(const int16_t* x0, const int16_t* x1, int n)
+{
+    const int16_t* z = fft_buf;
+
+    for (int i = 0; i < n; i++)
+    {
+        fft_buf[2 * i] = x0[i];
+        fft_buf[2 * i + 1] = x1[i];
+    }
+
+    dsps_fft2r_sc16(fft_buf, n);
+    dsps_bit_rev_sc16_ansi(fft_buf, n);
+
+    for (int k = 0; k <= n / 2; k++)
+    {
+        int nk = (n - k) % n;
+        int32_t a_re = (z[2 * k] + z[2 * nk]) >> 1;
+        int32_t a_im = (z[2 * k + 1] - z[2 * nk + 1]) >> 1;
+        int32_t b_re = (z[2 * k + 1] + z[2 * nk + 1]) >> 1;
+        int32_t b_im = (z[2 * nk] - z[2 * k]) >> 1;
+
+        int32_t g_re = ((a_re * b_re) >> 2) + ((a_im * b_im) >> 2);
+        int32_t g_im = ((a_re * b_im) >> 2) - ((a_im * b_re) >> 2);
+        int32_t p0 = ((a_re * a_re) >> 2) + ((a_im * a_im) >> 2);
+        int32_t p1 = ((b_re * b_re) >> 2) + ((b_im * b_im) >> 2);
+
+        xspec[2 * k] += (g_re - xspec[2 * k]) >> XSPEC_EWMA_SHIFT;
+        xspec[2 * k + 1] += (g_im - xspec[2 * k + 1]) >> XSPEC_EWMA_SHIFT;
+        pspec[2 * k] += (p0 - pspec[2 * k]) >> XSPEC_EWMA_SHIFT;
+        pspec[2 * k + 1] += (p1 - pspec[2 * k + 1]) >> XSPEC_EWMA_SHIFT;
+    }
+}
+
+/*
+    As float path. Coherence weights are Q15 (|W| <= 1), the lag grid
+    phase e^(j 2 pi k m / (LAG_DIV N)) comes from cos_tab, so the search
+    is 16x16 multiply-accumulates into int32.
+*/
+static void steer_update(int n)
+{
+    const unsigned int mask = LAG_DIV * n - 1;
+    int32_t best_r = INT32_MIN;
+    int32_t r_prev = 0, r_best_prev = 0, r_best_next = 0;
+    int have_next = 0;
+    int best = 0;
+    int frac_q8 = 0;
+
+    for (int k = 1; k < n / 2; k++)
+    {
+        uint32_t den = isqrt32(pspec[2 * k]) * isqrt32(pspec[2 * k + 1]) + 1;
+        wspec[2 * k] = sat_q15((int32_t) (((int64_t) xspec[2 * k] << 15) / den));
+        wspec[2 * k + 1] = sat_q15((int32_t) (((int64_t) xspec[2 * k + 1] << 15) / den));
+    }
+
+    for (int t = 0; t < N_LAG_STEPS; t += search_stride)
+    {
+        unsigned int step = (unsigned int) (t - APP_BEAM_MAX_LAG * LAG_DIV) & mask;
+        unsigned int j = 0;
+        int32_t r = 0;
+
+        for (int k = 1; k < n / 2; k++)
+        {
+            j = (j + step) & mask;
+            // Re(W e^(jx)), sin(x) = cos(x - pi/2)
+            r += (wspec[2 * k] * cos_tab[j]) >> 15;
+            r -= (wspec[2 * k + 1] * cos_tab[(j - n) & mask]) >> 15;
+        }
+
+        if (r > best_r)
+        {
+            best_r = r;
+            best = t;
+            r_best_prev = r_prev;
+            have_next = 0;
+        }
+        else if (t == best + search_stride)
+        {
+            r_best_next = r;
+            have_next = 1;
+        }
+        r_prev = r;
+    }
+
+    // Parabolic peak interpolation between grid points.
+    if ((best > 0) && have_next)
+    {
+        int32_t den = r_best_prev - 2 * best_r + r_best_next;
+        if (den < 0)
+            frac_q8 = (int) (((int64_t) (r_best_prev - r_best_next) * (Q8_ONE / 2)) / den);
+    }
+
+    steer_q8 = (-APP_BEAM_MAX_LAG * Q8_ONE) + ((best * Q8_ONE + frac_q8 * search_stride) / LAG_DIV);
+}
+
+typedef struct {
+    int i;
+    const int16_t* h;
+} frac_delay_t;
+
+static void frac_delay_init(frac_delay_t* fd, int delay_q8)
+{
+    fd->i = (delay_q8 / Q8_ONE) - 1;
+    fd->h = lagr_tab[delay_q8 % Q8_ONE];
+}
+
+static void beam_sum(int16_t* block, const int16_t* x0, const int16_t* x1,
+        int n, unsigned int n_channels)
+{
+    frac_delay_t fd0, fd1;
+
+    frac_delay_init(&fd0, BASE_DELAY * Q8_ONE + ((steer_q8 > 0) ? steer_q8 : 0));
+    frac_delay_init(&fd1, BASE_DELAY * Q8_ONE + ((steer_q8 < 0) ? -steer_q8 : 0));
+
+    const int16_t* h0 = fd0.h;
+    const int16_t* h1 = fd1.h;
+
+    for (int i = 0; i < n; i++)
+    {
+        const int16_t* p0 = &x0[i - fd0.i];
+        const int16_t* p1 = &x1[i - fd1.i];
+
+        // Q14 taps and half sum, >> 15 with rounding.
+        int32_t acc = 1 << 14;
+        acc += h0[0] * p0[0] + h0[1] * p0[-1] + h0[2] * p0[-2] + h0[3] * p0[-3];
+        acc += h1[0] * p1[0] + h1[1] * p1[-1] + h1[2] * p1[-2] + h1[3] * p1[-3];
+
+        block[i * n_channels] = sat_q15(acc >> 15);
+    }
+}
+
+float beamform_delay(void)
+{
+    return (float) steer_q8 / Q8_ONE;
+}
+
+#else
+
+static int alloc_state(unsigned int n_samples)
+{
+    esp_err_t ret;
+    unsigned int n_bins = n_samples / 2 + 1;
+
+    // FFT tables are shared with other esp-dsp users, never deinit.
+    ret = dsps_fft2r_init_fc32(NULL, n_samples);
+    if ((ret != ESP_OK) && (ret != ESP_ERR_DSP_REINITIALIZED))
+    {
+        printf("beamform: fft init failed = %d\n", ret);
+        return -1;
+    }
+
+    fft_buf = heap_caps_malloc(2 * n_samples * sizeof(float), MALLOC_CAP_INTERNAL);
+    xspec = heap_caps_calloc(2 * n_bins, sizeof(float), MALLOC_CAP_INTERNAL);
+    pspec = heap_caps_calloc(2 * n_bins, sizeof(float), MALLOC_CAP_INTERNAL);
+
+    if (!fft_buf || !xspec || !pspec)
+        return -1;
+
+    steer_delay = 0;
+
+    return 0;
+}
+
+static void free_state(void)
+{
+}
+
+/*
+    Both mics in one complex FFT (x0 real, x1 imaginary part), then
+    smooth cross and auto spectra over blocks. Loud blocks (preamble)
+    dominate the average as spectra are not normalized per block.
+*/
+static void xspec_update(const int16_t* x0, const int16_t* x1, int n)
+{
+    const float alpha = 1.0f / (1 << XSPEC_EWMA_SHIFT);
+    const float* z = fft_buf;
+
+    for (int i = 0; i < n; i++)
+    {
+        fft_buf[2 * i] = x0[i];
+        fft_buf[2 * i + 1] = x1[i];
+    }
+
+    dsps_fft2r_fc32(fft_buf, n);
+    dsps_bit_rev_fc32(fft_buf, n);
+
+    for (int k = 0; k <= n / 2; k++)
+    {
+        int nk = (n - k) % n;
+        // X0 = (Z[k] + conj(Z[n-k])) / 2, X1 = (Z[k] - conj(Z[n-k])) / 2j
+        float a_re = 0.5f * (z[2 * k] + z[2 * nk]);
+        float a_im = 0.5f * (z[2 * k + 1] - z[2 * nk + 1]);
+        float b_re = 0.5f * (z[2 * k + 1] + z[2 * nk + 1]);
+        float b_im = -0.5f * (z[2 * k] - z[2 * nk]);
+
+        // conj(X0) * X1
+        float g_re = a_re * b_re + a_im * b_im;
+        float g_im = a_re * b_im - a_im * b_re;
+
+        xspec[2 * k] += alpha * (g_re - xspec[2 * k]);
+        xspec[2 * k + 1] += alpha * (g_im - xspec[2 * k + 1]);
+        pspec[2 * k] += alpha * ((a_re * a_re + a_im * a_im) - pspec[2 * k]);
+        pspec[2 * k + 1] += alpha * ((b_re * b_re + b_im * b_im) - pspec[2 * k + 1]);
+    }
+}
+
+/*
+    SCOT weighted generalized cross-correlation, evaluated directly on
+    a fractional lag grid. Mic spacing is above half a wavelength in the
+    Trill band, integer lag correlation peaks land on a neighbouring
+    carrier cycle, whitening with coherence makes the true peak unique.
+    Sets lag in samples of mic 1 relative to mic 0.
+*/
+static void steer_update(int n)
+{
+    float best_r = -INFINITY;
+    float r_prev = 0, r_best_prev = 0, r_best_next = 0;
+    int best = 0;
+    float frac = 0;
+    float* wspec = fft_buf;
+
+    // Coherence weighted cross spectrum, FFT buffer is free by now.
+    for (int k = 1; k < n / 2; k++)
+    {
+        float den = sqrtf(pspec[2 * k] * pspec[2 * k + 1]) + 1e-9f;
+        wspec[2 * k] = xspec[2 * k] / den;
+        wspec[2 * k + 1] = xspec[2 * k + 1] / den;
+    }
+
+    for (int t = 0; t < N_LAG_STEPS; t += search_stride)
+    {
+        float tau = -APP_BEAM_MAX_LAG + (float) t / LAG_DIV;
+        float w = 2.0f * (float) M_PI * tau / n;
+        float rot_re = cosf(w), rot_im = sinf(w);
+        float e_re = 1.0f, e_im = 0.0f;
+        float r = 0;
+
+        for (int k = 1; k < n / 2; k++)
+        {
+            float tmp = e_re * rot_re - e_im * rot_im;
+            e_im = e_re * rot_im + e_im * rot_re;
+            e_re = tmp;
+
+            // Re(W e^(jwk tau))
+            r += wspec[2 * k] * e_re - wspec[2 * k + 1] * e_im;
+        }
+
+        if (r > best_r)
+        {
+            best_r = r;
+            best = t;
+            r_best_prev = r_prev;
+            r_best_next = NAN;
+        }
+        else if (t == best + search_stride)
+        {
+            r_best_next = r;
+        }
+        r_prev = r;
+    }
+
+    // Parabolic peak interpolation between grid points.
+    if ((best > 0) && !isnan(r_best_next))
+    {
+        float den = r_best_prev - 2.0f * best_r + r_best_next;
+        if (den < 0)
+            frac = 0.5f * (r_best_prev - r_best_next) / den;
+    }
+
+    steer_delay = -APP_BEAM_MAX_LAG + (best + frac * search_stride) / LAG_DIV;
+}
+
+/* x(n - delay) by 3rd order Lagrange, delay >= 1. */
+typedef struct {
+    int i;
+    float h[4];
+} frac_delay_t;
+
+static void frac_delay_init(frac_delay_t* fd, float delay)
+{
+    fd->i = (int) delay - 1;
+    lagrange_taps(delay - fd->i, fd->h);
+}
+
+static inline float frac_delay_at(const frac_delay_t* fd, const int16_t* x, int n)
+{
+    const int16_t* p = &x[n - fd->i];
+
+    return fd->h[0] * p[0] + fd->h[1] * p[-1] + fd->h[2] * p[-2] + fd->h[3] * p[-3];
+}
+
+static void beam_sum(int16_t* block, const int16_t* x0, const int16_t* x1,
+        int n, unsigned int n_channels)
+{
+    frac_delay_t fd0, fd1;
+
+    frac_delay_init(&fd0, BASE_DELAY + ((steer_delay > 0) ? steer_delay : 0));
+    frac_delay_init(&fd1, BASE_DELAY + ((steer_delay < 0) ? -steer_delay : 0));
+
+    for (int i = 0; i < n; i++)
+    {
+        // Half sum keeps full scale, coherent gain comes from lower noise.
+        float y = 0.5f * (frac_delay_at(&fd0, x0, i) + frac_delay_at(&fd1, x1, i));
+
+        if (y > 32767.0f)
+            y = 32767.0f;
+        else if (y < -32768.0f)
+            y = -32768.0f;
+        block[i * n_channels] = (int16_t) lrintf(y);
+    }
+}
+
+float beamform_delay(void)
+{
+    return steer_delay;
+}
+
+#endif
+
+float beamform_floor(void)
+{
+    return energy_floor;
+}
+
+void beamform_set_load(int level)
+{
+    search_stride = (level >= 1) ? LAG_DIV : 1;
+    steer_frozen = (level >= 2);
+}
+
+void beamform_seed(float floor, float delay)
+{
+    // Stored state may be corrupt, NaN passes the range checks.
+    if (!isfinite(delay) || (delay < -APP_BEAM_MAX_LAG) || (delay > APP_BEAM_MAX_LAG))
+        delay = 0;
+
+    seed_floor = (isfinite(floor) && (floor > 0)) ? floor : 0;
+    seed_delay = delay;
+}
+
+int beamform_init(unsigned int n_samples)
+{
+    block_n = n_samples;
+    energy_floor = seed_floor;
+
+    for (int m = 0; m < 2; m++)
+    {
+        line[m] = heap_caps_calloc(HIST_N + n_samples, sizeof(int16_t),
+                        MALLOC_CAP_INTERNAL);
+    }
+
+    if (!line[0] || !line[1] || (alloc_state(n_samples) < 0))
+    {
+        beamform_deinit();
+        return -1;
+    }
+
+#if APP_BEAM_Q15
+    steer_q8 = (int) lrintf(seed_delay * Q8_ONE);
+#else
+    steer_delay = seed_delay;
+#endif
+
+    return 0;
+}
+
+void beamform_deinit(void)
+{
+    for (int m = 0; m < 2; m++)
+    {
+        free(line[m]);
+        line[m] = NULL;
+    }
+    free_state();
+    free(fft_buf);
+    free(xspec);
+    free(pspec);
+    fft_buf = NULL;
+    xspec = NULL;
+    pspec = NULL;
+}
+
+void beamform_process(int16_t* block, unsigned int n_samples,
+        unsigned int n_channels, int demod_active)
+{
+    int16_t* x0;
+    int16_t* x1;
+
+    if ((line[0] == NULL) || (n_samples != block_n) || (n_channels < 2))
+        return;
+
+    x0 = &line[0][HIST_N];
+    x1 = &line[1][HIST_N];
+
+    for (unsigned int i = 0; i < n_samples; i++)
+    {
+        x0[i] = block[i * n_channels];
+        x1[i] = block[i * n_channels + 1];
+    }
+
+    if (!demod_active)
+    {
+        int64_t acc = 0;
+        float e;
+
+        for (unsigned int i = 0; i < n_samples; i++)
+            acc += (int32_t) x0[i] * x0[i] + (int32_t) x1[i] * x1[i];
+        e = (float) acc / n_samples;
+
+        // Steer only on blocks well above the quiet level (CTS preamble).
+        if (!steer_frozen && (energy_floor > 0) && (e > energy_floor * APP_BEAM_GATE_RATIO))
+        {
+            xspec_update(x0, x1, (int) n_samples);
+            steer_update((int) n_samples);
+        }
+
+        if ((energy_floor == 0) || (e < energy_floor))
+            energy_floor = e;
+        else
+            energy_floor += FLOOR_EWMA_ALPHA * (e - energy_floor);
+    }
+
+    // Delay whichever mic hears the wavefront first.
+    beam_sum(block, x0, x1, (int) n_samples, n_channels);
+
+    memmove(line[0], &x0[n_samples - HIST_N], HIST_N * sizeof(int16_t));
+    memmove(line[1], &x1[n_samples - HIST_N], HIST_N * sizeof(int16_t));
+}
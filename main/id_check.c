@@ -0,0 +1,116 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+
+#include "trill.h"
+#include "trill_error.h"
+#include "app_config.h"
+#include "tx_cache.h"
+#include "tx_queue.h"
+#include "trace.h"
+#include "id_check.h"
+
+static id_check_report_cb_t report_cb;
+static trill_tx_params_t default_params;
+static uint8_t info[TRILL_MAX_DATA_PAYLOAD_LEN];
+static unsigned int info_len;
+static int enabled;
+
+// Reply in flight, set from trill task, cleared from TX queue task.
+static volatile int pending;
+static unsigned int pending_id;
+static trill_data_config_range_t pending_range;
+static int64_t req_us;
+
+static volatile unsigned int n_dropped;
+static unsigned int n_replies;
+
+int id_check_init(const id_check_cfg_t* cfg, id_check_report_cb_t cb)
+{
+    if ((cfg == NULL) || (cfg->info_len > sizeof(info)))
+        return TRILL_ERR_INVALID_PARAMETERS;
+
+    memcpy(info, cfg->info, cfg->info_len);
+    info_len = cfg->info_len;
+    default_params.ssi = cfg->ssi;
+    default_params.ck_nonce = cfg->ck_nonce;
+    default_params.data_cfg_range = cfg->range;
+    report_cb = cb;
+    pending = 0;
+    n_dropped = 0;
+    n_replies = 0;
+    enabled = 1;
+
+    // Only the range the app currently sends at is prepared. Replies
+    // at other ranges are modulated when first requested and captured
+    // by TX queue, later ones replay.
+    if (tx_cache_is_cacheable(&default_params) &&
+        (tx_queue_prepare(&default_params, info, info_len, NULL) < 0))
+    {
+        printf("id check: reply not prepared\n");
+    }
+
+    return 0;
+}
+
+void id_check_deinit(void)
+{
+    enabled = 0;
+    pending = 0;
+    printf("id check: %u replies, %u requests dropped\n", n_replies, n_dropped);
+}
+
+void id_check_on_req(const trill_data_link_event_params_t* params)
+{
+    trill_tx_params_t tx_params = default_params;
+
+    if (!enabled)
+        return;
+
+    if (pending)
+    {
+        n_dropped++;
+        return;
+    }
+
+    // Peer decoded its own request at this range, answer with the same.
+    if ((params->data_cfg_range >= TRILL_DATA_CFG_RANGE_NEAR) &&
+        (params->data_cfg_range <= TRILL_DATA_CFG_RANGE_FAR))
+    {
+        tx_params.data_cfg_range = params->data_cfg_range;
+    }
+
+    req_us = trace_now_us();
+    pending_range = tx_params.data_cfg_range;
+    pending = 1;
+
+    // Id is stored before the reply is queued.
+    if (tx_queue_send_reply(&tx_params, info, info_len, &pending_id) < 0)
+    {
+        pending = 0;
+        n_dropped++;
+    }
+}
+
+int id_check_on_tx_done(unsigned int id, int result)
+{
+    id_check_report_t report;
+
+    if (!pending || (id != pending_id))
+        return 0;
+
+    report.range = pending_range;
+    report.result = result;
+    report.latency_us = trace_now_us() - req_us;
+    report.n_dropped = n_dropped;
+
+    if (result == 0)
+        n_replies++;
+    pending = 0;
+
+    if (report_cb)
+        report_cb(&report);
+
+    return 1;
+}
@@ -10,4 +10,207 @@
 
 #define TRILLBIT_LICENSE_PATH   "/spiffs/trillbit.lic"
 
+/*
+ * Render governor: while the SDK reports TRILL_PROC_DEMOD_PROGRESS
+ * LVGL runs only once every APP_UI_GOV_DEMOD_TICK_DIV loop ticks and
+ * posted label updates are held back until the packet is done.
+ * Set to 0 to compare counters without the governor.
+ */
+#define APP_UI_GOV_EN               1
+#define APP_UI_GOV_DEMOD_TICK_DIV   10
+
+/*
+ * Number of RX payload buffers that can be held at the same time,
+ * by UI, echo and any other consumer. Refer to rx_pool.h
+ */
+#define APP_RX_POOL_DEPTH           4
+
+/*
+ * TX queue. Packets queued back to back are sent as one burst with
+ * APP_TX_GUARD_MS of silence between them. Refer to tx_queue.h
+ */
+#define APP_TX_QUEUE_DEPTH          4
+#define APP_TX_GUARD_MS             50
+#define APP_TX_SENT_TIMEOUT_MS      30000
+
+/*
+ * Listen before talk ahead of each TX burst. Inter frame gap must be
+ * longer than APP_TX_GUARD_MS. Off by default, a packet waits at most
+ * APP_LBT_MAX_WAIT_MS for a busy room. Refer to lbt.h
+ */
+#define APP_LBT_EN                  0
+#define APP_LBT_BUSY_RATIO          3.0f
+#define APP_LBT_IFS_MS              150
+#define APP_LBT_SLOT_MS             50
+#define APP_LBT_CW_MIN              8
+#define APP_LBT_CW_MAX              128
+#define APP_LBT_MAX_WAIT_MS         3000
+/* Busy longer than any burst is background noise, floor follows it. */
+#define APP_LBT_FLOOR_RISE_MS       20000
+
+/*
+ * Reply to ID check requests with device info from the data link
+ * callback. Prepares one reply waveform per SDK start, off by default.
+ * Refer to id_check.h
+ */
+#define APP_ID_CHECK_EN             0
+
+/*
+ * Modulated waveform cache in PSRAM, off with 0 entries. When enabled
+ * it takes up to APP_TX_CACHE_MAX_BYTES plus the capture buffer.
+ * Refer to tx_cache.h
+ */
+#define APP_TX_CACHE_ENTRIES        0
+#define APP_TX_CACHE_MAX_BYTES      (1024 * 1024)
+/* Longest waveform that can be cached, ~5.4 s at 48 kHz. */
+#define APP_TX_CACHE_CAPTURE_BYTES  (512 * 1024)
+
+/*
+ * TX range controller thresholds on smoothed RX SNR estimate.
+ * After a CRC failure range steps down and is held for some packets.
+ * Refer to link_quality.h
+ */
+#define APP_LINK_SNR_NEAR_DB        20.0f
+#define APP_LINK_SNR_MID_DB         10.0f
+#define APP_LINK_SNR_HYST_DB        3.0f
+#define APP_LINK_FAIL_HOLD_PACKETS  3
+
+/*
+ * Transport layer for long messages. Timeouts must cover airtime of
+ * a full size packet at FAR range. Refer to transport.h
+ */
+#define APP_XPORT_ACK_TIMEOUT_MS    20000
+#define APP_XPORT_RX_IDLE_MS        15000
+#define APP_XPORT_MAX_ROUNDS        5
+/* Receiver holds an ACK until sender's burst ended or was this quiet. */
+#define APP_XPORT_ACK_HOLD_MS       3000
+/* Fragments per XOR parity packet in first round, 0 disables FEC. */
+#define APP_XPORT_FEC_GROUP         4
+
+/*
+ * Byte stream over the data link. Partial segments wait up to
+ * APP_STREAM_FLUSH_MS for more writes. Refer to stream.h
+ */
+#define APP_STREAM_RING_LEN         2048
+#define APP_STREAM_FLUSH_MS         500
+#define APP_STREAM_RX_IDLE_MS       15000
+
+/*
+ * Delay-and-sum beam of the two mics fed to SDK as channel 0.
+ * Max lag covers mic spacing (~6.5 cm) at 48 kHz with margin.
+ * Off until range and SNR gain over channel 0 alone are measured.
+ * Refer to beamform.h
+ */
+#define APP_BEAM_EN                 0
+#define APP_BEAM_MAX_LAG            10
+/*
+ * Block energy over quiet level needed to re-steer (CTS preamble).
+ * 3 dB, FAR range preambles arrive only a few dB over a noisy room.
+ */
+#define APP_BEAM_GATE_RATIO         2.0f
+/*
+ * Fixed-point beam path (sc16 FFT, Q15 weights, Q14 taps) instead of
+ * float. Only the app's beam front end gets cheaper, SDK decoding (CTS
+ * correlation, symbol energy) is inside the library and is unchanged.
+ * test/host/beam_compare measures it against the float path: steering
+ * within 0.02 samples, output within 1 LSB for the same delay, on a
+ * synthetic corpus only. Off until checked on recorded audio.
+ * Refer to beamform.c
+ */
+#define APP_BEAM_Q15                0
+
+/*
+ * Low power listen mode. SDK is fed and CPU held at max clock only
+ * after high band energy rises over the adaptive quiet level.
+ * Blocks are 1024 samples (~21 ms). DFS needs CONFIG_PM_ENABLE.
+ * Off, and PM off in the shipped configs, until wake sensitivity and
+ * missed CTS are measured on a board. Refer to listen.h
+ */
+#define APP_LISTEN_EN               0
+#define APP_LISTEN_MIN_CPU_MHZ      80
+#define APP_LISTEN_DECIM            4
+/* Stage 1 thresholds: energy over quiet level, high band fraction (0..1). */
+#define APP_LISTEN_WAKE_RATIO       2.0f
+#define APP_LISTEN_BAND_FRAC        0.25f
+/* Stage 2: blocks SDK gets to find CTS in a flagged window. */
+#define APP_LISTEN_CONFIRM_BLOCKS   12
+/* Pre-roll must cover wake latency into the CTS preamble. */
+#define APP_LISTEN_PREROLL_BLOCKS   4
+#define APP_LISTEN_HANGOVER_BLOCKS  50
+/* Duty cycle and cascade counters print period, ~60 s. */
+#define APP_LISTEN_REPORT_BLOCKS    2812
+
+/*
+ * Pipeline trace ring, dumped on the console when SDK is stopped.
+ * 8 bytes per event, in PSRAM. A full dump holds the UI for ~11 s,
+ * enable for profiling builds only. Refer to trace.h
+ */
+#define APP_TRACE_EN                0
+#define APP_TRACE_EVENTS            8192
+
+/*
+ * Worst case trill_process latency print period, 0 to disable.
+ * Compares runs with and without CONFIG_TRILL_SDK_IRAM_HOT, set e.g.
+ * 10000 for those.
+ */
+#define APP_PROC_LATENCY_REPORT_MS  0
+
+/*
+ * Load shedding when SDK falls behind, refer to load_shed.h.
+ * RX ring fill levels for each shedding step, app work budget
+ * per 1024 sample block (21.3 ms), calm blocks before stepping down.
+ */
+#define APP_SHED_COARSE_PCT         25
+#define APP_SHED_FREEZE_PCT         50
+#define APP_SHED_BUDGET_US          4000
+#define APP_SHED_HOLD_BLOCKS        24
+/* Full ring retry, below one block period. */
+#define APP_SHED_RETRY_US           15000
+#define APP_SHED_REPORT_BLOCKS      2812
+
+/*
+ * SDK allocations by purpose. Audio rings hot: internal DRAM,
+ * else PSRAM. Blocks over the table size are not counted in the
+ * report. Refer to sdk_mem.h
+ */
+#define APP_SDK_MEM_AUDIO_HOT       1
+#define APP_SDK_MEM_MAX_BLOCKS      128
+/* Table blocks shared between SDK instances. */
+#define APP_SDK_MEM_SHARED_MAX      32
+/*
+ * Create a second SDK instance at init, loop a packet of its own
+ * back into it and check shared tables and memory saved. Blocks
+ * cover TX of a short NEAR packet, then RX of it.
+ */
+#define APP_SDK_SHARE_TEST          0
+#define APP_SDK_SHARE_TEST_BLOCKS   250
+
+/*
+ * Keep adaptive quiet levels, beam steering and TX range in NVS
+ * so a restart does not converge from scratch. Saved on SDK stop
+ * and periodically, never while a packet is demodulated or sent.
+ * Refer to warm_state.h
+ */
+#define APP_WARM_EN                 1
+#define APP_WARM_SAVE_PERIOD_S      900
+
+/*
+ * SDK start/stop soak test at boot, 0 cycles to disable.
+ * Fails on SDK allocations left after deinit or heap free size /
+ * largest block per region dropping below the warm-up level.
+ * Refer to soak.h
+ */
+#define APP_SOAK_CYCLES             0
+#define APP_SOAK_WARMUP_CYCLES      3
+#define APP_SOAK_REPORT_CYCLES      100
+#define APP_SOAK_RX_BLOCKS          20
+#define APP_SOAK_TX_BLOCKS          4
+#define APP_SOAK_HEAP_SLACK         0
+
+/*
+ * Check ChaCha20-Poly1305 override against RFC 8439 vector and
+ * print its speed at boot. Refer to rfc8439.h
+ */
+#define APP_CRYPTO_SELF_TEST        0
+
 #endif /* INC_APP_CONFIG_H_ */
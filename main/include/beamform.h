@@ -0,0 +1,40 @@
+#ifndef _BEAMFORM_H_
+#define _BEAMFORM_H_
+
+#include <stdint.h>
+
+/*
+    Delay-and-sum beam of the two on-board mics.
+    Inter-mic delay is estimated by generalized cross-correlation on loud
+    blocks while SDK hunts for CTS (preamble), and is frozen while it
+    demodulates.
+    Steered beam replaces channel 0 of the interleaved block, which is
+    the only channel enabled for decoding.
+    APP_BEAM_Q15 runs this front end in fixed point. SDK decoding of the
+    beam is not affected by it, its cost stays that of one channel.
+*/
+
+/* Feed task: before first block. n_samples per channel. */
+int beamform_init(unsigned int n_samples);
+void beamform_deinit(void);
+
+/* Feed task: in place on one interleaved block, channels 0 and 1. */
+void beamform_process(int16_t* block, unsigned int n_samples, 
+        unsigned int n_channels, int demod_active);
+
+/* Current steering delay of mic 1 relative to mic 0, in samples. */
+float beamform_delay(void);
+
+/* Gate quiet level, 0 until first block. */
+float beamform_floor(void);
+
+/*
+    Feed task: load shedding level, refer to load_shed.h.
+    1 searches steering on integer lags only, 2 keeps last steering.
+*/
+void beamform_set_load(int level);
+
+/* Warm start from a previous run, applied by next beamform_init. */
+void beamform_seed(float floor, float delay);
+
+#endif //_BEAMFORM_H_
@@ -0,0 +1,52 @@
+#ifndef _ID_CHECK_H_
+#define _ID_CHECK_H_
+
+#include <stdint.h>
+
+#include "trill.h"
+
+/*
+    Automatic reply to TRILL_DATA_LINK_EVT_ID_CHECK_REQ with a device
+    info payload set at init.
+
+    Reply is queued from the data link callback itself, at the front of
+    TX queue and without listen before talk: the peer just finished its
+    request and waits for the answer. The reply uses the range the
+    request came at. A plain text reply is prepared at init for cfg
+    range only, other ranges are modulated on their first request and
+    replayed from the TX waveform cache after that. The exchange is
+    reported to the app after the reply was sent.
+
+    One reply is in flight at a time, requests meanwhile are counted
+    and dropped.
+*/
+
+typedef struct {
+    const uint8_t* info;            // copied, up to TRILL_MAX_DATA_PAYLOAD_LEN
+    unsigned int info_len;
+    trill_data_encryption_scheme_t ssi;
+    unsigned char* ck_nonce;        // must stay valid until id_check_deinit
+    trill_data_config_range_t range;    // prepared, and used when request range is unknown
+} id_check_cfg_t;
+
+typedef struct {
+    trill_data_config_range_t range;
+    int result;                     // TX result of the reply
+    int64_t latency_us;             // request received to reply sent
+    unsigned int n_dropped;         // requests dropped so far
+} id_check_report_t;
+
+/* Called from TX queue task. Must not call id_check_ functions. */
+typedef void (*id_check_report_cb_t)(const id_check_report_t* report);
+
+/* After tx_queue_start. */
+int id_check_init(const id_check_cfg_t* cfg, id_check_report_cb_t report_cb);
+void id_check_deinit(void);
+
+/* Trill task, data link callback. */
+void id_check_on_req(const trill_data_link_event_params_t* params);
+
+/* TX queue done callback. Returns 1 if id was the reply. */
+int id_check_on_tx_done(unsigned int id, int result);
+
+#endif //_ID_CHECK_H_
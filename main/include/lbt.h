@@ -0,0 +1,40 @@
+#ifndef _LBT_H_
+#define _LBT_H_
+
+#include <stdint.h>
+
+/*
+    Listen before talk. Every node in a room hears every packet, so TX
+    started blindly collides with a packet already in the air.
+
+    Channel is busy while mic in-band energy is over the quiet level, or
+    SDK demodulates, and for APP_LBT_IFS_MS after. The gap is longer
+    than the tx_queue guard, so a peer's burst is not cut in between.
+    A level held for APP_LBT_FLOOR_RISE_MS becomes the new quiet level.
+
+    Before the first packet of a burst TX queue contends for the channel:
+    random backoff of [0, cw) slots, counted down only while idle. Each
+    busy period seen while waiting doubles cw up to APP_LBT_CW_MAX.
+    After APP_LBT_MAX_WAIT_MS the packet is sent anyway.
+
+    scripts/lbt/lbt_sim.py simulates nodes sharing a room with these
+    parameters.
+*/
+
+/* Feed task: every input block heard while own TX is off. */
+void lbt_feed_block(const int16_t* block, unsigned int n_samples, unsigned int n_channels);
+
+/* Trill task: SDK is demodulating a packet. */
+void lbt_note_demod(void);
+
+/* 
+    TX queue task: before first packet of a burst. 0 won, 1 waited too
+    long, -1 when *stop was set while waiting.
+*/
+int lbt_acquire(const volatile int* stop);
+
+int lbt_channel_busy(void);
+
+void lbt_print_stats(void);
+
+#endif //_LBT_H_
@@ -0,0 +1,47 @@
+#ifndef _LINK_QUALITY_H_
+#define _LINK_QUALITY_H_
+
+#include <stdint.h>
+
+#include "trill.h"
+
+/*
+    Link quality estimate from mic audio and a TX range controller.
+    Noise floor is tracked while SDK hunts for CTS, signal level while
+    it demodulates, giving an SNR estimate per received packet.
+    TX range is chosen from smoothed SNR and decode failures.
+*/
+
+typedef struct {
+    float snr_db;
+    float signal_dbfs;
+    float noise_dbfs;
+} link_rx_metrics_t;
+
+/* Feed task: one interleaved input block, before adding it to SDK. */
+void link_quality_feed_block(const int16_t* block, unsigned int n_samples, 
+        unsigned int n_channels, unsigned int channel, int demod_active);
+
+/* Trill task: packet received / failed CRC. */
+void link_quality_on_rx(const trill_data_link_event_params_t* params, 
+        link_rx_metrics_t* metrics);
+void link_quality_on_rx_error(int err);
+
+/* Fastest range config expected to be reliable for TX. */
+trill_data_config_range_t link_rate_select(void);
+
+/* Seeds set by link_quality_seed are applied, else starts cold. */
+void link_quality_reset(void);
+
+/* Warm start state. snr_valid is 0 until a packet was received. */
+typedef struct {
+    float noise_energy;
+    float snr_db;
+    int snr_valid;
+    trill_data_config_range_t tx_range;
+} link_quality_state_t;
+
+void link_quality_get_state(link_quality_state_t* st);
+void link_quality_seed(const link_quality_state_t* st);
+
+#endif //_LINK_QUALITY_H_
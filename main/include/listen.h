@@ -0,0 +1,54 @@
+#ifndef _LISTEN_H_
+#define _LISTEN_H_
+
+#include <stdint.h>
+
+/*
+    Low power listen mode. While the room is quiet SDK is not fed and
+    the CPU runs at a low clock (DFS).
+
+    CTS detection is a cascade. Stage 1 is a decimated high band energy
+    detector with adaptive threshold, tuned for recall. It wakes up:
+    CPU max freq lock is taken and buffered pre-roll blocks are fed first
+    so the CTS preamble that triggered the wake is not lost. Stage 2 is
+    SDK full CTS search and timing, run only on the flagged window.
+    If it does not start demodulating in time the flag is a false alarm
+    and it goes back to sleep, else stays awake while SDK demodulates or
+    TX is busy, plus a hangover.
+*/
+
+typedef enum {
+    LISTEN_SLEEP = 0,   // do not feed SDK, block is kept in pre-roll
+    LISTEN_WAKE,        // feed listen_preroll_pop() blocks, then this one
+    LISTEN_AWAKE,       // feed this block
+} listen_state_t;
+
+/* 
+    app_main: once, before SDK tasks. Sets DFS limits and creates the
+    CPU max freq lock. < 0 without DFS, listen then only gates decode.
+*/
+int listen_pm_init(void);
+
+/* Feed task: before first block. */
+int listen_init(unsigned int n_samples, unsigned int n_channels);
+void listen_deinit(void);
+
+/* Feed task: every interleaved input block. */
+listen_state_t listen_block(const int16_t* block, int demod_active, int tx_busy);
+
+/* Feed task: after LISTEN_WAKE, oldest first, NULL when drained. */
+int16_t* listen_preroll_pop(void);
+
+/* Trill task: packet received / failed. */
+void listen_on_rx(void);
+void listen_on_rx_error(int err);
+
+/* Stage 1 quiet level, 0 until first block. */
+float listen_floor(void);
+
+/* Warm start from a previous run, applied by next listen_init. */
+void listen_seed_floor(float e);
+
+void listen_print_stats(void);
+
+#endif //_LISTEN_H_
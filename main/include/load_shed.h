@@ -0,0 +1,50 @@
+#ifndef _LOAD_SHED_H_
+#define _LOAD_SHED_H_
+
+#include <stdint.h>
+
+#include "trill.h"
+
+/*
+    Deadline aware feeding of the SDK RX ring. SDK has no cycle budget,
+    so work is shed on the app side in this order when it falls behind:
+
+    LOAD_SHED_COARSE    beam steering searched on integer lags only
+    LOAD_SHED_FREEZE    beam steering kept, no cross spectrum update
+
+    Only app work is shed, it costs sensitivity, never packets. Blocks
+    are always added: SDK demod state trails the ring, a block that
+    looks like CTS search input may hold a packet already in the ring.
+
+    Level rises with RX ring backlog (SDK buffer notifications), with
+    app work over APP_SHED_BUDGET_US per block and at once to FREEZE 
+    when the ring is full. It falls one level after APP_SHED_HOLD_BLOCKS
+    calm blocks. A full ring is retried for up to APP_SHED_RETRY_US,
+    a block is lost only when SDK did not free a slot by then.
+*/
+
+typedef enum {
+    LOAD_SHED_NONE = 0,
+    LOAD_SHED_COARSE,
+    LOAD_SHED_FREEZE,
+    LOAD_SHED_N_LEVELS
+} load_shed_level_t;
+
+/* Before trill_init. n_blocks of RX ring. */
+void load_shed_reset(unsigned int n_blocks);
+
+/* trill_init_opts_t aud_buf_rx_notify_cb. */
+void load_shed_on_rx_buf(trill_audio_buf_notify_ids_t event);
+
+/* Feed task: per block, before any work on it. */
+load_shed_level_t load_shed_update(void);
+
+/* Feed task: app time spent on block, block retried on full ring,
+   result of adding the block. */
+void load_shed_work_done(int64_t work_us);
+void load_shed_note_retry(void);
+void load_shed_on_add(int ret, int demod_active);
+
+void load_shed_print_stats(void);
+
+#endif //_LOAD_SHED_H_
@@ -0,0 +1,41 @@
+#ifndef _RFC8439_H_
+#define _RFC8439_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+    ChaCha20-Poly1305 AEAD (RFC 8439) used by the SDK for SSI_SIMPLE and
+    SSI_FULL_RFC8439 packets.
+
+    Defining these symbols in the application overrides the portable
+    implementation inside libtrill_core_sdk.a (portable8439.c.obj),
+    the linker then never pulls that object from the archive.
+    Signatures must stay identical to the SDK's portable8439 copy.
+*/
+
+#define RFC_8439_TAG_SIZE       16
+#define RFC_8439_KEY_SIZE       32
+#define RFC_8439_NONCE_SIZE     12
+#define RFC_8439_FAIL           ((size_t) -1)
+
+/* Returns cipher text size including tag. */
+size_t portable_chacha20_poly1305_encrypt(
+    uint8_t* cipher_text,
+    const uint8_t key[RFC_8439_KEY_SIZE],
+    const uint8_t nonce[RFC_8439_NONCE_SIZE],
+    const uint8_t* ad, size_t ad_size,
+    const uint8_t* plain_text, size_t plain_text_size);
+
+/* Returns plain text size or RFC_8439_FAIL if tag does not match. */
+size_t portable_chacha20_poly1305_decrypt(
+    uint8_t* plain_text,
+    const uint8_t key[RFC_8439_KEY_SIZE],
+    const uint8_t nonce[RFC_8439_NONCE_SIZE],
+    const uint8_t* ad, size_t ad_size,
+    const uint8_t* cipher_text, size_t cipher_text_size);
+
+/* RFC 8439 section 2.8.2 vector and cycles per byte. 0 on success. */
+int rfc8439_self_test(void);
+
+#endif //_RFC8439_H_
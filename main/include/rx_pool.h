@@ -0,0 +1,33 @@
+#ifndef _RX_POOL_H_
+#define _RX_POOL_H_
+
+#include <stdatomic.h>
+
+#include "trill.h"
+#include "link_quality.h"
+
+/*
+    Fixed pool of reference counted RX payload buffers.
+    SDK payload is copied once in the data link callback, after that
+    the buffer can be handed to other tasks by pointer.
+    Every rx_buf_retain must be paired with rx_buf_release.
+*/
+typedef struct {
+    atomic_int refs;
+    unsigned int len;
+    int ssi;
+    trill_data_config_range_t data_cfg_range;
+    int channel;
+    link_rx_metrics_t metrics;
+    unsigned char data[TRILL_MAX_DATA_PAYLOAD_LEN];
+} rx_buf_t;
+
+/* Returns buffer with one reference held or NULL if pool is exhausted. */
+rx_buf_t* rx_buf_from_event(const trill_data_link_event_params_t* params);
+void rx_buf_retain(rx_buf_t* buf);
+void rx_buf_release(rx_buf_t* buf);
+
+unsigned int rx_pool_in_use(void);
+unsigned int rx_pool_exhausted_count(void);
+
+#endif //_RX_POOL_H_
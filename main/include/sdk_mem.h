@@ -0,0 +1,63 @@
+#ifndef _SDK_MEM_H_
+#define _SDK_MEM_H_
+
+#include <stddef.h>
+
+/*
+    Allocator callbacks for the SDK with placement by purpose.
+    SDK allocator interface carries no purpose, so each request is tagged
+    here: registered sizes (audio rings) first, then alignment, 16 byte
+    aligned blocks are ESP-DSP working buffers, other aligned blocks are
+    tables. Hot tags go to internal DRAM, cold tags to PSRAM, each falls
+    back to the other region when full.
+    Live and peak bytes are counted per tag and region for the report.
+
+    SDK instances cannot be given a shared context, so read-only tables
+    are shared here. Between sdk_mem_share_begin/end (around trill_init)
+    the n-th table request gets the block the first instance got for its
+    n-th request, if size and alignment match, reference counted. The
+    later instance regenerates the same content in place, so instances
+    must not be running while another one is initialized. Checksums
+    taken after the first init verify content is really identical, a
+    block that differs is not a read-only table: first instance content
+    is restored and the later instance must be deinitialized.
+*/
+
+typedef enum {
+    SDK_MEM_STATE = 0,  // unaligned, not registered
+    SDK_MEM_DSP,        // 16 byte aligned, ESP-DSP working buffers
+    SDK_MEM_TABLE,      // other alignment, sine/cosine and twiddle tables
+    SDK_MEM_AUDIO_RX,   // registered with sdk_mem_expect
+    SDK_MEM_AUDIO_TX,
+    SDK_MEM_N_TAGS
+} sdk_mem_tag_t;
+
+/* Before trill_init. Size of a block or whole ring the SDK may request,
+   a size already registered keeps its tag. */
+void sdk_mem_expect(sdk_mem_tag_t tag, size_t size);
+
+/* trill_init_opts_t callbacks. */
+void* sdk_mem_alloc(unsigned int size);
+void* sdk_mem_aligned_alloc(unsigned int alignment, unsigned int size);
+void sdk_mem_free(void* ptr);
+
+/* 
+    Around trill_init. end returns count of shared tables whose content
+    differs, the instance just initialized must not be used then.
+*/
+void sdk_mem_share_begin(void);
+int sdk_mem_share_end(void);
+
+/* Count of shared tables changed since first init. */
+int sdk_mem_share_verify(void);
+
+/* Bytes not allocated thanks to shared tables. */
+unsigned int sdk_mem_shared_saved(void);
+
+/* Live SDK bytes and blocks, untracked blocks count as outstanding. */
+unsigned int sdk_mem_outstanding(unsigned int* n_blocks);
+unsigned int sdk_mem_peak(void);
+
+void sdk_mem_report(void);
+
+#endif //_SDK_MEM_H_
@@ -5,6 +5,7 @@
 
 #define SER_CMD_CMD_WAIT_TIMEOUT	1000
 #define SER_CMD_DATA_WAIT_TIMEOUT	3000
+#define SER_CMD_LIC_APPLY_TIMEOUT	10000
 
 #define SER_CMD_MAX_DATA_BUFFER_SIZE	256
 
@@ -32,6 +33,25 @@ typedef enum
 	SER_CMD_ERROR_CODE_APPLY_KEYS_FAILED,
 } serial_command_errors_t;
 
-int ser_cmd_init(void);
+/**
+ * Called from the console task once a complete license was
+ * received and saved. License string stays valid until the app
+ * reports the outcome with ser_cmd_lic_result. Return negative to
+ * reject it at once.
+ */
+typedef int (*lic_set_cb_t)(const char* b64_license);
+
+/* Pass NULL callback to reboot after a license is saved. */
+int ser_cmd_init(lic_set_cb_t cb);
+
+/* Stops applying licenses, later ones are saved followed by a reboot. */
+int ser_cmd_deinit(void);
+
+/**
+ * License passed to lic_set_cb was accepted (0) or rejected (negative).
+ * Host gets the reply to its set command now. A rejected license is
+ * removed and the previous license file restored.
+ */
+void ser_cmd_lic_result(int result);
 
 #endif //_SERIAL_COM_H_
\ No newline at end of file
@@ -0,0 +1,25 @@
+#ifndef _SOAK_H_
+#define _SOAK_H_
+
+/*
+    SDK start/stop soak test. Every cycle runs init, synthetic RX audio,
+    TX start, TX abort and deinit. SDK allocations are counted by the
+    sdk_mem allocator hooks, heap free size and largest free block are
+    sampled per region. Any SDK allocation left after deinit, or heap
+    free/largest block below the level after warm-up, fails the test.
+    main.c reads the license once before the run and gives the SDK stub
+    callbacks, so file system, board audio and UI state stay out of the
+    samples. test/host builds it against a fake SDK.
+*/
+
+typedef struct {
+    int (*init)(void** handle);     // trill_init with app options
+    void (*deinit)(void* handle);
+    unsigned int n_samples;         // per channel, of one input block
+    unsigned int n_channels;
+} soak_ops_t;
+
+/* Before SDK tasks and UI start. 0 on pass. */
+int soak_run(const soak_ops_t* ops, unsigned int n_cycles);
+
+#endif //_SOAK_H_
@@ -0,0 +1,69 @@
+#ifndef _STREAM_H_
+#define _STREAM_H_
+
+#include <stdint.h>
+
+#include "trill.h"
+
+/*
+    Byte stream over the data link, for telemetry and other small,
+    frequent writes.
+
+    SDK modulates whole packets only, each with its own CTS, header and
+    flush, so the carrier cannot be kept between writes. Instead writes
+    go into a TX ring and leave as full size segments, queued back to
+    back in one tx_queue burst: mic feed stays paused and only the guard
+    interval separates them. A partial segment is sent once its oldest
+    byte waited APP_STREAM_FLUSH_MS.
+
+    Receiver hands out each segment as an incremental chunk in order.
+    Segment CRC is a running CRC-32 over all stream bytes up to its end,
+    so the receiver checks continuity, not only the single packet.
+    Lost segments are reported, not retransmitted: telemetry prefers
+    new data over late data.
+
+    Segment: | 0xF4 | stream id, 0x80 last | seq (16 bit, LE) | running crc (LE) | data... |
+
+    Type byte is above ASCII so plain text packets pass through.
+*/
+
+#define STREAM_HDR_LEN          8
+#define STREAM_SEG_DATA_LEN     (TRILL_MAX_DATA_PAYLOAD_LEN - STREAM_HDR_LEN)
+
+typedef struct {
+    uint8_t id;
+    const uint8_t* data;
+    unsigned int len;
+    unsigned int offset;        // received stream bytes before this chunk
+    unsigned int lost;          // segments missing before this chunk
+    int crc_ok;                 // running CRC matched, 0 after a gap
+    int last;                   // sender closed the stream
+} stream_chunk_t;
+
+/* Called from trill task per segment. Must not call stream_ functions. */
+typedef void (*stream_rx_cb_t)(const stream_chunk_t* chunk);
+
+int stream_init(stream_rx_cb_t rx_cb);
+void stream_reset(void);
+
+/* One TX stream at a time. params->ck_nonce must stay valid until closed. */
+int stream_open(const trill_tx_params_t* params);
+
+/* Bytes are copied. Returns count taken, less than len when ring is full. */
+int stream_write(const uint8_t* data, unsigned int len);
+
+/* Remaining bytes are flushed, last segment is marked. */
+int stream_close(void);
+
+/* Non-zero from stream_open until the last segment is queued. */
+int stream_tx_busy(void);
+
+/* From data link callback. Returns 1 if packet belonged to a stream. */
+int stream_on_rx(const uint8_t* pkt, unsigned int len);
+
+/* Call periodically, drives segmenting, flush and RX idle timeout. */
+void stream_poll(void);
+
+void stream_print_stats(void);
+
+#endif //_STREAM_H_
@@ -0,0 +1,74 @@
+#ifndef _TRACE_H_
+#define _TRACE_H_
+
+#include <stdint.h>
+
+#include "esp_timer.h"
+#include "app_config.h"
+
+/*
+    Pipeline trace. Tasks record compact binary begin/end/instant events
+    into an in-memory ring, stamped by a 64-bit monotonic microsecond
+    clock and the core they ran on. Writers only take a slot with an
+    atomic increment, the ring is not locked.
+
+    trace_dump() prints the ring on the console between TRACE_START and
+    TRACE_STOP lines. scripts/trace/trace_to_chrome.py turns a captured
+    console log into Chrome/Perfetto trace JSON, one process per core
+    and one thread per task.
+
+    SDK internals are not visible, SDK stages are the spans of its API
+    calls. trill_process spans end with the stage it returned.
+*/
+
+typedef enum {
+    TRACE_FEED_BLOCK = 0,       // feed: one block into SDK
+    TRACE_FEED_BEAM,            // feed: beamform_process
+    TRACE_FEED_SDK_ADD,         // feed: trill_add_audio_block
+    TRACE_FEED_WAKE,            // feed: listen wake (instant)
+    TRACE_PLAY_SDK_ACQUIRE,     // play: trill_acquire_audio_block
+    TRACE_PLAY_I2S,             // play: i2s_write
+    TRACE_TRILL_PROCESS,        // trill: trill_process begin
+    TRACE_SDK_CTS_SEARCH,       // trill: trill_process end, per return
+    TRACE_SDK_DEMOD,
+    TRACE_SDK_PACKET_SENT,
+    TRACE_SDK_ERROR,
+    TRACE_RX_PACKET,            // trill: packet received (instant)
+    TRACE_TX_SENT,              // trill: packet sent (instant)
+    TRACE_UI_TICK,              // ui: one loop tick
+    TRACE_UI_RENDER,            // ui: lv_task_handler
+    TRACE_TXQ_SEND,             // txq: one queued packet
+    TRACE_N_IDS
+} trace_id_t;
+
+typedef enum {
+    TRACE_PH_BEGIN = 0,
+    TRACE_PH_END,
+    TRACE_PH_INSTANT,
+} trace_phase_t;
+
+/* Monotonic, does not wrap. Usable with tracing off. */
+static inline int64_t trace_now_us(void)
+{
+    return esp_timer_get_time();
+}
+
+int trace_init(void);
+
+/* Any task. Dropped until trace_init and while dumping. */
+void trace_event(trace_id_t id, trace_phase_t ph);
+
+/* Traced tasks should be stopped or idle. Ring is emptied. */
+void trace_dump(void);
+
+#if APP_TRACE_EN
+#define TRACE_BEGIN(id)     trace_event((id), TRACE_PH_BEGIN)
+#define TRACE_END(id)       trace_event((id), TRACE_PH_END)
+#define TRACE_INSTANT(id)   trace_event((id), TRACE_PH_INSTANT)
+#else
+#define TRACE_BEGIN(id)     do {} while (0)
+#define TRACE_END(id)       do {} while (0)
+#define TRACE_INSTANT(id)   do {} while (0)
+#endif
+
+#endif //_TRACE_H_
@@ -0,0 +1,58 @@
+#ifndef _TRANSPORT_H_
+#define _TRANSPORT_H_
+
+#include <stdint.h>
+
+#include "trill.h"
+
+/*
+    Transport layer above the data link for messages longer than
+    TRILL_MAX_DATA_PAYLOAD_LEN.
+
+    Message is split into numbered fragments sent as one burst through
+    tx_queue. Receiver reassembles them and answers with a bitmap ACK,
+    sender then resends only the missing fragments (selective repeat).
+
+    With APP_XPORT_FEC_GROUP > 0, first round also carries one XOR 
+    parity packet after every group of that many fragments. Receiver 
+    rebuilds a single lost (CRC failed) fragment per group from it, 
+    without waiting for a retransmission.
+
+    ACKs go out at the end of the sender's burst: after the last
+    fragment, or after the last parity when the fragments' count has
+    bit 7 set. When the end was not heard, receiver waits until the
+    sender was quiet for APP_XPORT_ACK_HOLD_MS. Works with blind TX.
+
+    Fragment: | 0xF1 | msg id | index | count | data...                   |
+    Parity:   | 0xF3 | msg id | group | count | last len | group size | xor |
+    ACK:      | 0xF2 | msg id | received bitmap (32 bit, LE)               |
+
+    Type bytes are above ASCII so plain text packets pass through.
+*/
+
+#define XPORT_HDR_LEN           4
+#define XPORT_PARITY_HDR_LEN    6
+#define XPORT_FRAG_DATA_LEN     (TRILL_MAX_DATA_PAYLOAD_LEN - XPORT_PARITY_HDR_LEN)
+#define XPORT_MAX_FRAGS         32
+#define XPORT_MAX_MSG_LEN       (XPORT_MAX_FRAGS * XPORT_FRAG_DATA_LEN)
+
+/* Called from trill task with complete message. Must not call xport_ functions. */
+typedef void (*xport_rx_cb_t)(const uint8_t* msg, unsigned int len);
+/* Called from xport_poll with 0 or negative error. Must not call xport_ functions. */
+typedef void (*xport_tx_done_cb_t)(int result);
+
+int xport_init(xport_rx_cb_t rx_cb, xport_tx_done_cb_t tx_done_cb);
+void xport_reset(void);
+
+/* Message is copied. Only one message can be in flight. */
+int xport_send(const trill_tx_params_t* params, const uint8_t* msg, unsigned int len);
+
+/* From data link callback. Returns 1 if packet belonged to transport. */
+int xport_on_rx(const uint8_t* pkt, unsigned int len);
+
+int xport_tx_busy(void);
+
+/* Call periodically, drives sending, ACKs and timeouts. */
+void xport_poll(void);
+
+#endif //_TRANSPORT_H_
@@ -0,0 +1,46 @@
+#ifndef _TX_CACHE_H_
+#define _TX_CACHE_H_
+
+#include <stdint.h>
+
+#include "trill.h"
+
+/*
+    Cache of modulated TX waveforms in PSRAM, LRU evicted.
+    Waveform is captured from SDK TX blocks while a packet is sent 
+    (or silently prepared) and replayed from memory next time the 
+    same packet is sent, without running the modulator.
+
+    Only plain text packets without nonce override are cached, 
+    encrypted packets must not repeat.
+
+    Entries are created and looked up only from the TX queue task.
+    Block hooks are called only from the play task.
+*/
+
+typedef struct tx_cache_entry tx_cache_entry_t;
+
+typedef void (*tx_cache_play_done_cb_t)(void);
+
+int tx_cache_init(void);
+int tx_cache_is_cacheable(const trill_tx_params_t* params);
+tx_cache_entry_t* tx_cache_find(const trill_tx_params_t* params, 
+        const unsigned char* data, unsigned int data_len);
+
+/* mute: consume SDK blocks without playing them. */
+tx_cache_entry_t* tx_cache_capture_begin(const trill_tx_params_t* params, 
+        const unsigned char* data, unsigned int data_len, int mute);
+/* Waits for play task to store remaining blocks. Returns 0 if entry is ready. */
+int tx_cache_capture_end(int ok);
+
+int tx_cache_play_start(tx_cache_entry_t* entry, tx_cache_play_done_cb_t done_cb);
+void tx_cache_play_stop(void);
+
+/* Play task hooks */
+int tx_cache_play_block(int16_t* block, unsigned int n_samples);
+int tx_cache_sdk_block(const int16_t* block, unsigned int n_samples);
+void tx_cache_sdk_idle(void);
+
+void tx_cache_print_stats(void);
+
+#endif //_TX_CACHE_H_
@@ -0,0 +1,61 @@
+#ifndef _TX_QUEUE_H_
+#define _TX_QUEUE_H_
+
+#include "trill.h"
+
+/*
+    Queue of TX packets sent one after another by a dedicated task.
+    Consecutive packets form a burst: mic feed stays paused between 
+    them and only a short guard interval is inserted. A burst starts
+    when the channel is clear, refer to lbt.h
+*/
+
+/* Called from TX queue task when a packet was sent or failed. */
+typedef void (*tx_queue_done_cb_t)(unsigned int id, int result);
+
+int tx_queue_start(void* trill_handle, tx_queue_done_cb_t cb);
+int tx_queue_stop(void);
+
+/* 
+    Packet data is copied, params->ck_nonce must stay valid until 
+    the packet is reported done. id (can be NULL) is reported back in 
+    done callback.
+*/
+int tx_queue_send(const trill_tx_params_t* params, 
+        const unsigned char* data, unsigned int data_len, unsigned int* id);
+
+/* 
+    As tx_queue_send, but ahead of queued packets and without waiting
+    for a clear channel. For answers the peer waits for.
+*/
+int tx_queue_send_reply(const trill_tx_params_t* params, 
+        const unsigned char* data, unsigned int data_len, unsigned int* id);
+
+/* 
+    Modulate the packet into TX waveform cache without playing it.
+    Later tx_queue_send of same packet replays the stored waveform.
+    Refer to tx_cache.h for packets which can be cached.
+*/
+int tx_queue_prepare(const trill_tx_params_t* params, 
+        const unsigned char* data, unsigned int data_len, unsigned int* id);
+
+/* 
+    Free slots. Senders that retry on a full queue check it before
+    building a packet, a failed send is then a real overflow.
+*/
+unsigned int tx_queue_space(void);
+
+/* Call from data link callback on TRILL_DATA_LINK_EVT_DATA_SENT. */
+void tx_queue_on_sent(void);
+
+/* Non-zero from first dequeued packet until queue drained. Prepared
+   packets do not count. */
+int tx_queue_in_burst(void);
+
+/* As tx_queue_in_burst, less the listen before talk wait. Refer to lbt.h */
+int tx_queue_on_air(void);
+
+/* Non-zero while a packet is silently modulated for the cache. */
+int tx_queue_preparing(void);
+
+#endif //_TX_QUEUE_H_
@@ -1,14 +1,31 @@
 #ifndef _UI_H_
 #define _UI_H_
 
+#include "trill.h"
+#include "rx_pool.h"
+
+#define UI_MSG_MAX_LEN  TRILL_MAX_DATA_PAYLOAD_LEN
+
 typedef int (*echo_cb_t)(void);
 typedef int (*start_cb_t)(void);
 
 int ui_start(void);
-int ui_set_rx_msg(const char* txt);
 int ui_en_echo(int en);
 int ui_set_echo_callback(echo_cb_t cb);
+int ui_set_echo_long_callback(echo_cb_t cb);
 int ui_set_start_callback(start_cb_t cb);
 int ui_lic_error(const char* dev_id);
 
+/*
+    Non-blocking, safe to call from SDK callbacks.
+    ui_post_rx_buf takes over the caller's reference to buf.
+    Posted updates are applied by ui_process_events from the LVGL loop.
+*/
+int ui_post_rx_buf(rx_buf_t* buf);
+int ui_post_en_echo(int en);
+int ui_process_events(void);
+
+/* Last RX buffer shown on display. Call only from LVGL loop. Can be NULL. */
+const rx_buf_t* ui_get_shown_rx_buf(void);
+
 #endif //_UI_H_
@@ -0,0 +1,18 @@
+#ifndef _WARM_STATE_H_
+#define _WARM_STATE_H_
+
+/*
+    Warm start of the adaptive quiet levels, so thresholds do not have to
+    converge again after boot or SDK restart. Listen wake floor, beam gate
+    floor and steering, link noise floor, SNR average and TX range are
+    kept as one small blob in NVS.
+    SDK internal CTS thresholds are not accessible and still start cold.
+*/
+
+/* Before SDK tasks start. Seeds modules, < 0 when nothing was stored. */
+int warm_state_load(void);
+
+/* After SDK tasks stop, or periodically. */
+int warm_state_save(void);
+
+#endif //_WARM_STATE_H_
@@ -0,0 +1,155 @@
+#include <stdio.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_system.h"
+
+#include "app_config.h"
+#include "lbt.h"
+
+#define FLOOR_EWMA_ALPHA    0.02f
+#define FLOOR_RISE_ALPHA    0.005f
+
+static float floor_energy;
+static TickType_t busy_since;
+static int busy_run;
+static volatile TickType_t last_activity;
+static volatile int activity_seen;
+
+static unsigned int n_acquires;
+static unsigned int n_immediate;
+static unsigned int n_deferrals;
+static unsigned int n_forced;
+static unsigned int wait_ms_max;
+static unsigned int wait_ms_total;
+
+static void note_activity(void)
+{
+    last_activity = xTaskGetTickCount();
+    activity_seen = 1;
+}
+
+/* First difference energy, weighted towards the high band Trill uses. */
+void lbt_feed_block(const int16_t* block, unsigned int n_samples, unsigned int n_channels)
+{
+    int64_t acc = 0;
+    float e;
+
+    for (unsigned int i = n_channels; i < n_samples * n_channels; i += n_channels)
+    {
+        int32_t d = block[i] - block[i - n_channels];
+        acc += d * d;
+    }
+
+    e = (float) acc / n_samples;
+
+    if (floor_energy == 0)
+    {
+        floor_energy = e;
+    }
+    else if (e > floor_energy * APP_LBT_BUSY_RATIO)
+    {
+        // Floor does not learn from packets in the air, but does from
+        // a level held longer than any burst (fan, HVAC).
+        if (!busy_run)
+        {
+            busy_run = 1;
+            busy_since = xTaskGetTickCount();
+        }
+        else if ((xTaskGetTickCount() - busy_since) >= pdMS_TO_TICKS(APP_LBT_FLOOR_RISE_MS))
+        {
+            floor_energy += FLOOR_RISE_ALPHA * (e - floor_energy);
+        }
+        note_activity();
+    }
+    else
+    {
+        busy_run = 0;
+        floor_energy += FLOOR_EWMA_ALPHA * (e - floor_energy);
+    }
+}
+
+void lbt_note_demod(void)
+{
+    note_activity();
+}
+
+int lbt_channel_busy(void)
+{
+    if (!activity_seen)
+        return 0;
+
+    return (xTaskGetTickCount() - last_activity) < pdMS_TO_TICKS(APP_LBT_IFS_MS);
+}
+
+int lbt_acquire(const volatile int* stop)
+{
+    TickType_t start = xTaskGetTickCount();
+    unsigned int cw = APP_LBT_CW_MIN;
+    unsigned int slots = esp_random() % cw;
+    unsigned int waited;
+    int was_busy = 0;
+    int ret = 0;
+
+    if (!APP_LBT_EN)
+        return 0;
+
+    n_acquires++;
+    if (!lbt_channel_busy() && (slots == 0))
+    {
+        n_immediate++;
+        return 0;
+    }
+
+    while (1)
+    {
+        if (*stop)
+        {
+            ret = -1;
+            break;
+        }
+
+        if ((xTaskGetTickCount() - start) >= pdMS_TO_TICKS(APP_LBT_MAX_WAIT_MS))
+        {
+            n_forced++;
+            ret = 1;
+            break;
+        }
+
+        if (lbt_channel_busy())
+        {
+            // Others contend for the same idle gap, spread out more.
+            if (!was_busy)
+            {
+                n_deferrals++;
+                if (cw < APP_LBT_CW_MAX)
+                    cw *= 2;
+                slots = esp_random() % cw;
+            }
+            was_busy = 1;
+        }
+        else
+        {
+            was_busy = 0;
+            if (slots == 0)
+                break;
+            slots--;
+        }
+
+        vTaskDelay(pdMS_TO_TICKS(APP_LBT_SLOT_MS));
+    }
+
+    waited = (xTaskGetTickCount() - start) * portTICK_PERIOD_MS;
+    wait_ms_total += waited;
+    if (waited > wait_ms_max)
+        wait_ms_max = waited;
+
+    return ret;
+}
+
+void lbt_print_stats(void)
+{
+    printf("lbt: %u bursts, %u immediate, %u deferrals, %u forced, wait avg %u max %u ms\n",
+        n_acquires, n_immediate, n_deferrals, n_forced,
+        n_acquires ? wait_ms_total / n_acquires : 0, wait_ms_max);
+}
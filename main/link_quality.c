@@ -0,0 +1,171 @@
+#include <stdio.h>
+#include <math.h>
+
+#include "trill.h"
+#include "trill_error.h"
+#include "app_config.h"
+#include "link_quality.h"
+
+#define NOISE_EWMA_ALPHA    0.05f
+#define SNR_EWMA_ALPHA      0.3f
+#define ENERGY_MIN          1e-3f
+#define Q15_FULL_SCALE_SQ   (32768.0f * 32768.0f)
+
+static volatile float noise_energy;
+static volatile float demod_energy_acc;
+static volatile unsigned int demod_blocks;
+static volatile float last_packet_energy;
+
+// Rate controller, updated only from trill task.
+static float snr_ewma;
+static int n_rx_packets;
+static trill_data_config_range_t tx_range = TRILL_DATA_CFG_RANGE_FAR;
+static int hold_packets;
+
+static link_quality_state_t seed;
+
+static float energy_dbfs(float e)
+{
+    if (e < ENERGY_MIN)
+        e = ENERGY_MIN;
+    return 10.0f * log10f(e / Q15_FULL_SCALE_SQ);
+}
+
+void link_quality_feed_block(const int16_t* block, unsigned int n_samples, 
+        unsigned int n_channels, unsigned int channel, int demod_active)
+{
+    int64_t acc = 0;
+    float e;
+
+    for (unsigned int i = channel; i < n_samples * n_channels; i += n_channels)
+    {
+        acc += (int32_t) block[i] * block[i];
+    }
+
+    e = (float) acc / n_samples;
+
+    if (demod_active)
+    {
+        demod_energy_acc += e;
+        demod_blocks++;
+    }
+    else
+    {
+        if (demod_blocks)
+        {
+            last_packet_energy = demod_energy_acc / demod_blocks;
+            demod_energy_acc = 0;
+            demod_blocks = 0;
+        }
+
+        if (noise_energy == 0)
+            noise_energy = e;
+        else
+            noise_energy += NOISE_EWMA_ALPHA * (e - noise_energy);
+    }
+}
+
+static void rate_update(float snr_db)
+{
+    trill_data_config_range_t target;
+
+    if (n_rx_packets++ == 0)
+        snr_ewma = snr_db;
+    else
+        snr_ewma += SNR_EWMA_ALPHA * (snr_db - snr_ewma);
+
+    if (hold_packets > 0)
+    {
+        hold_packets--;
+        return;
+    }
+
+    if (snr_ewma >= APP_LINK_SNR_NEAR_DB)
+        target = TRILL_DATA_CFG_RANGE_NEAR;
+    else if (snr_ewma >= APP_LINK_SNR_MID_DB)
+        target = TRILL_DATA_CFG_RANGE_MID;
+    else
+        target = TRILL_DATA_CFG_RANGE_FAR;
+
+    if (target < tx_range)
+    {
+        // Faster config only with margin above threshold.
+        float need = (target == TRILL_DATA_CFG_RANGE_NEAR) ? 
+                        APP_LINK_SNR_NEAR_DB : APP_LINK_SNR_MID_DB;
+        if (snr_ewma < (need + APP_LINK_SNR_HYST_DB))
+            return;
+    }
+
+    tx_range = target;
+}
+
+void link_quality_on_rx(const trill_data_link_event_params_t* params, 
+        link_rx_metrics_t* metrics)
+{
+    float sig = demod_blocks ? (demod_energy_acc / demod_blocks) : last_packet_energy;
+    float noise = noise_energy;
+
+    metrics->signal_dbfs = energy_dbfs(sig);
+    metrics->noise_dbfs = energy_dbfs(noise);
+    // Signal energy includes noise.
+    metrics->snr_db = energy_dbfs(sig > noise ? sig - noise : ENERGY_MIN) - 
+                        metrics->noise_dbfs;
+
+    rate_update(metrics->snr_db);
+}
+
+void link_quality_on_rx_error(int err)
+{
+    if (err != TRILL_ERR_DATA_DEC_CRC_CHECK_FAILED)
+        return;
+
+    // Step down to a more robust config and stay there for a while.
+    if (tx_range < TRILL_DATA_CFG_RANGE_FAR)
+        tx_range++;
+
+    hold_packets = APP_LINK_FAIL_HOLD_PACKETS;
+}
+
+trill_data_config_range_t link_rate_select(void)
+{
+    return tx_range;
+}
+
+void link_quality_reset(void)
+{
+    noise_energy = seed.noise_energy;
+    demod_energy_acc = 0;
+    demod_blocks = 0;
+    last_packet_energy = 0;
+    n_rx_packets = 0;
+    hold_packets = 0;
+    tx_range = TRILL_DATA_CFG_RANGE_FAR;
+
+    if (seed.snr_valid)
+    {
+        // SNR average continues from the seed.
+        snr_ewma = seed.snr_db;
+        n_rx_packets = 1;
+        tx_range = seed.tx_range;
+    }
+}
+
+void link_quality_get_state(link_quality_state_t* st)
+{
+    st->noise_energy = noise_energy;
+    st->snr_db = snr_ewma;
+    st->snr_valid = (n_rx_packets > 0);
+    st->tx_range = tx_range;
+}
+
+void link_quality_seed(const link_quality_state_t* st)
+{
+    seed = *st;
+
+    if (!isfinite(seed.noise_energy) || (seed.noise_energy < 0))
+        seed.noise_energy = 0;
+
+    if (!isfinite(seed.snr_db) ||
+        (seed.tx_range < TRILL_DATA_CFG_RANGE_NEAR) || (seed.tx_range > TRILL_DATA_CFG_RANGE_FAR))
+        seed.snr_valid = 0;
+}
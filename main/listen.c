@@ -0,0 +1,313 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "sdkconfig.h"
+#include "esp_heap_caps.h"
+#if CONFIG_PM_ENABLE
+#include "esp_pm.h"
+#endif
+
+#include "trill_error.h"
+#include "app_config.h"
+#include "listen.h"
+
+#define FLOOR_EWMA_ALPHA    0.01f
+#define ENERGY_MIN          1.0f
+
+static int16_t* preroll;
+static unsigned int block_len;     // samples of all channels
+static unsigned int block_n;
+static unsigned int block_ch;
+static unsigned int preroll_head;
+static unsigned int preroll_count;
+
+static listen_state_t state;
+static float floor_energy;
+static float seed_floor;
+static unsigned int quiet_blocks;
+
+#if CONFIG_PM_ENABLE
+static esp_pm_lock_handle_t cpu_lock;
+#endif
+
+static unsigned int n_blocks;
+static unsigned int n_awake_blocks;
+static unsigned int n_wakes;
+static volatile unsigned int n_rx;
+static volatile unsigned int n_rx_errors;
+
+// Cascade: stage 1 here, stage 2 is SDK CTS search on flagged windows.
+static unsigned int confirm_left;
+static unsigned int last_flag_block;
+static int prev_demod;
+static unsigned int n_s1_flags;
+static unsigned int n_s2_confirms;
+static unsigned int n_false_alarms;
+static unsigned int n_s1_misses;
+
+/*
+    Stage 1 on every APP_LISTEN_DECIM-th sample of channel 0, a few
+    MACs per block. Flags a rise of first difference energy over the
+    quiet level where most of the energy is in the high band Trill uses.
+    First difference energy over 4x raw energy is ~0 for low tones and
+    approaches 1 towards Nyquist.
+*/
+static int stage1(const int16_t* block, float* energy)
+{
+    int64_t acc_d = 0, acc_x = 0;
+    unsigned int step = APP_LISTEN_DECIM * block_ch;
+    unsigned int n = 0;
+    float band_frac;
+
+    for (unsigned int i = block_ch; i < block_len; i += step)
+    {
+        int32_t x = block[i];
+        int32_t d = x - block[i - block_ch];
+        acc_d += d * d;
+        acc_x += x * x;
+        n++;
+    }
+
+    *energy = (float) acc_d / n;
+    band_frac = acc_x ? ((float) acc_d / (4.0f * acc_x)) : 0;
+
+    return (floor_energy > 0) &&
+            (*energy > floor_energy * APP_LISTEN_WAKE_RATIO) &&
+            (band_frac >= APP_LISTEN_BAND_FRAC);
+}
+
+static void cpu_fast(int en)
+{
+#if CONFIG_PM_ENABLE
+    if (cpu_lock == NULL)
+        return;
+
+    if (en)
+        esp_pm_lock_acquire(cpu_lock);
+    else
+        esp_pm_lock_release(cpu_lock);
+#else
+    (void) en;
+#endif
+}
+
+int listen_pm_init(void)
+{
+#if CONFIG_PM_ENABLE
+    esp_pm_config_esp32s3_t pm_config = {
+        .max_freq_mhz = CONFIG_ESP32S3_DEFAULT_CPU_FREQ_MHZ,
+        .min_freq_mhz = APP_LISTEN_MIN_CPU_MHZ,
+        .light_sleep_enable = false,
+    };
+
+    if (cpu_lock)
+        return 0;
+
+    if ((esp_pm_configure(&pm_config) != ESP_OK) ||
+        (esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "listen", &cpu_lock) != ESP_OK))
+    {
+        printf("listen: DFS not available, gating decode only.\n");
+        cpu_lock = NULL;
+        return -1;
+    }
+
+    return 0;
+#else
+    printf("listen: CONFIG_PM_ENABLE off, gating decode only.\n");
+    return -1;
+#endif
+}
+
+int listen_init(unsigned int n_samples, unsigned int n_channels)
+{
+    block_n = n_samples;
+    block_ch = n_channels;
+    block_len = n_samples * n_channels;
+
+    preroll = heap_caps_malloc(APP_LISTEN_PREROLL_BLOCKS * block_len * sizeof(int16_t),
+                    MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (preroll == NULL)
+        return -1;
+
+    preroll_head = 0;
+    preroll_count = 0;
+    floor_energy = seed_floor;
+    quiet_blocks = 0;
+    n_blocks = 0;
+    n_awake_blocks = 0;
+    n_wakes = 0;
+    n_rx = 0;
+    n_rx_errors = 0;
+    confirm_left = 0;
+    last_flag_block = 0;
+    prev_demod = 0;
+    n_s1_flags = 0;
+    n_s2_confirms = 0;
+    n_false_alarms = 0;
+    n_s1_misses = 0;
+
+    // Start awake so the floor settles before first sleep.
+    state = LISTEN_AWAKE;
+    cpu_fast(1);
+
+    return 0;
+}
+
+void listen_deinit(void)
+{
+    // Lock itself lives as long as the app, only drop the hold.
+    if (state != LISTEN_SLEEP)
+        cpu_fast(0);
+
+    free(preroll);
+    preroll = NULL;
+}
+
+static void preroll_push(const int16_t* block)
+{
+    unsigned int slot = (preroll_head + preroll_count) % APP_LISTEN_PREROLL_BLOCKS;
+
+    memcpy(&preroll[slot * block_len], block, block_len * sizeof(int16_t));
+
+    if (preroll_count < APP_LISTEN_PREROLL_BLOCKS)
+        preroll_count++;
+    else
+        preroll_head = (preroll_head + 1) % APP_LISTEN_PREROLL_BLOCKS;
+}
+
+int16_t* listen_preroll_pop(void)
+{
+    int16_t* block;
+
+    if (preroll_count == 0)
+        return NULL;
+
+    block = &preroll[preroll_head * block_len];
+    preroll_head = (preroll_head + 1) % APP_LISTEN_PREROLL_BLOCKS;
+    preroll_count--;
+
+    return block;
+}
+
+listen_state_t listen_block(const int16_t* block, int demod_active, int tx_busy)
+{
+    float e;
+    int flag = stage1(block, &e);
+    int busy = demod_active || tx_busy;
+    int demod_start = demod_active && !prev_demod;
+
+    prev_demod = demod_active;
+
+    if ((++n_blocks % APP_LISTEN_REPORT_BLOCKS) == 0)
+        listen_print_stats();
+
+    // Floor follows quiet blocks only, drops at once.
+    if ((floor_energy == 0) || (e < floor_energy))
+        floor_energy = (e < ENERGY_MIN) ? ENERGY_MIN : e;
+    else if (!flag && !busy)
+        floor_energy += FLOOR_EWMA_ALPHA * (e - floor_energy);
+
+    if (flag)
+        last_flag_block = n_blocks;
+
+    // New candidate window for stage 2.
+    if (flag && !busy && !confirm_left)
+    {
+        n_s1_flags++;
+        confirm_left = APP_LISTEN_CONFIRM_BLOCKS;
+    }
+
+    if (state == LISTEN_SLEEP)
+    {
+        if (!flag && !busy)
+        {
+            preroll_push(block);
+            return LISTEN_SLEEP;
+        }
+
+        cpu_fast(1);
+        n_wakes++;
+        quiet_blocks = 0;
+        n_awake_blocks++;
+        state = LISTEN_WAKE;
+        return LISTEN_WAKE;
+    }
+
+    // Pre-roll is only valid right after wake.
+    preroll_count = 0;
+    n_awake_blocks++;
+
+    if (demod_start)
+    {
+        if (confirm_left)
+            n_s2_confirms++;
+        else if ((n_blocks - last_flag_block) > APP_LISTEN_CONFIRM_BLOCKS)
+            n_s1_misses++;  // SDK found CTS that stage 1 did not flag.
+        confirm_left = 0;
+    }
+    else if (confirm_left && (--confirm_left == 0))
+    {
+        // Stage 2 found no CTS in the flagged window.
+        n_false_alarms++;
+        if (!busy)
+        {
+            // Sustained non-Trill sound: raise the wake level above it.
+            floor_energy = e;
+            quiet_blocks = APP_LISTEN_HANGOVER_BLOCKS;
+        }
+    }
+
+    if (busy || confirm_left)
+        quiet_blocks = 0;
+    else if (quiet_blocks < APP_LISTEN_HANGOVER_BLOCKS)
+        quiet_blocks++;
+
+    if (quiet_blocks >= APP_LISTEN_HANGOVER_BLOCKS)
+    {
+        cpu_fast(0);
+        preroll_push(block);
+        state = LISTEN_SLEEP;
+        return LISTEN_SLEEP;
+    }
+
+    state = LISTEN_AWAKE;
+    return LISTEN_AWAKE;
+}
+
+float listen_floor(void)
+{
+    return floor_energy;
+}
+
+void listen_seed_floor(float e)
+{
+    seed_floor = (isfinite(e) && (e > 0)) ? e : 0;
+}
+
+void listen_on_rx(void)
+{
+    n_rx++;
+}
+
+void listen_on_rx_error(int err)
+{
+    if (err != TRILL_ERR_DATA_DEC_CRC_CHECK_FAILED)
+        return;
+
+    n_rx_errors++;
+}
+
+void listen_print_stats(void)
+{
+    unsigned int n_attempts = n_rx + n_rx_errors;
+
+    printf("listen: awake %u/%u blocks (%.1f%%), wakes %u, rx %u, rx errors %u (%.1f%%)\n",
+        n_awake_blocks, n_blocks,
+        n_blocks ? (100.0f * n_awake_blocks / n_blocks) : 0.0f,
+        n_wakes, n_rx, n_rx_errors,
+        n_attempts ? (100.0f * n_rx_errors / n_attempts) : 0.0f);
+    printf("cascade: s1 flags %u, s2 confirms %u, false alarms %u, s1 misses %u\n",
+        n_s1_flags, n_s2_confirms, n_false_alarms, n_s1_misses);
+}
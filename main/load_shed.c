@@ -0,0 +1,153 @@
+#include <stdio.h>
+#include <stdatomic.h>
+
+#include "trill.h"
+#include "app_config.h"
+#include "load_shed.h"
+
+static atomic_uint rx_writes;
+static atomic_uint rx_reads;
+static unsigned int ring_blocks;
+static int notify_ok;
+
+static load_shed_level_t level;
+static load_shed_level_t work_level;
+static unsigned int calm_blocks;
+static int full_hold;     // blocks kept at FREEZE after a full ring
+
+static unsigned int n_blocks;
+static unsigned int n_level[LOAD_SHED_N_LEVELS];
+static unsigned int n_over_budget;
+static unsigned int n_retried;
+static unsigned int n_demod_lost;
+static unsigned int n_add_failed;
+
+void load_shed_reset(unsigned int n)
+{
+    atomic_store(&rx_writes, 0);
+    atomic_store(&rx_reads, 0);
+    ring_blocks = n;
+    notify_ok = 1;
+    level = LOAD_SHED_NONE;
+    work_level = LOAD_SHED_NONE;
+    calm_blocks = 0;
+    full_hold = 0;
+    n_blocks = 0;
+    for (int i = 0; i < LOAD_SHED_N_LEVELS; i++)
+        n_level[i] = 0;
+    n_over_budget = 0;
+    n_retried = 0;
+    n_demod_lost = 0;
+    n_add_failed = 0;
+}
+
+void load_shed_on_rx_buf(trill_audio_buf_notify_ids_t event)
+{
+    if (event == TRILL_AUDIO_BUFFER_NOTIFY_WRITE)
+        atomic_fetch_add(&rx_writes, 1);
+    else if (event == TRILL_AUDIO_BUFFER_NOTIFY_READ)
+        atomic_fetch_add(&rx_reads, 1);
+}
+
+static int backlog_raw(void)
+{
+    return (int) (atomic_load(&rx_writes) - atomic_load(&rx_reads));
+}
+
+static unsigned int backlog(void)
+{
+    int b = backlog_raw();
+
+    if (!notify_ok || (b < 0))
+        return 0;
+    return ((unsigned int) b > ring_blocks) ? ring_blocks : (unsigned int) b;
+}
+
+load_shed_level_t load_shed_update(void)
+{
+    unsigned int fill_pct = ring_blocks ? (100 * backlog() / ring_blocks) : 0;
+    load_shed_level_t target;
+
+    if (fill_pct >= APP_SHED_FREEZE_PCT)
+        target = LOAD_SHED_FREEZE;
+    else if (fill_pct >= APP_SHED_COARSE_PCT)
+        target = LOAD_SHED_COARSE;
+    else
+        target = LOAD_SHED_NONE;
+
+    if (work_level > target)
+        target = work_level;
+
+    if (full_hold)
+    {
+        full_hold--;
+        target = LOAD_SHED_FREEZE;
+    }
+
+    if (target >= level)
+    {
+        level = target;
+        calm_blocks = 0;
+    }
+    else if (++calm_blocks >= APP_SHED_HOLD_BLOCKS)
+    {
+        level--;
+        calm_blocks = 0;
+    }
+
+    n_blocks++;
+    n_level[level]++;
+
+    if ((n_blocks % APP_SHED_REPORT_BLOCKS) == 0)
+        load_shed_print_stats();
+
+    return level;
+}
+
+void load_shed_work_done(int64_t work_us)
+{
+    if (work_us > APP_SHED_BUDGET_US)
+    {
+        n_over_budget++;
+        if (work_level < LOAD_SHED_FREEZE)
+            work_level++;
+    }
+    else if (work_level > LOAD_SHED_NONE)
+    {
+        work_level--;
+    }
+}
+
+void load_shed_on_add(int ret, int demod_active)
+{
+    if (ret < 0)
+    {
+        n_add_failed++;
+        if (demod_active)
+            n_demod_lost++;
+        full_hold = APP_SHED_HOLD_BLOCKS;
+        return;
+    }
+
+    // Ring took a block it should have no room for: notifications are
+    // not per block in this SDK build, go by add failures only.
+    if (notify_ok && ring_blocks && (backlog_raw() > (int) ring_blocks))
+    {
+        notify_ok = 0;
+        printf("load shed: RX buffer notifications not usable\n");
+    }
+}
+
+void load_shed_note_retry(void)
+{
+    n_retried++;
+}
+
+void load_shed_print_stats(void)
+{
+    printf("load shed: blocks %u, coarse %u, freeze %u, over budget %u\n",
+        n_blocks, n_level[LOAD_SHED_COARSE], n_level[LOAD_SHED_FREEZE],
+        n_over_budget);
+    printf("load shed: retried %u, blocks lost %u, lost while demod %u\n",
+        n_retried, n_add_failed, n_demod_lost);
+}
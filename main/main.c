@@ -11,6 +11,7 @@
 #include <math.h>
 #include <dirent.h>
 
+#include "sdkconfig.h"
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
@@ -29,6 +30,7 @@
 #include "nvs_flash.h"
 #include "esp_task.h"
 #include "esp_heap_caps.h"
+#include "esp_mac.h"
 
 #include "trill.h"
 #include "trill_error.h"
@@ -39,6 +41,22 @@
 #include "ui.h"
 #include "version.h"
 #include "serial_com.h"
+#include "rx_pool.h"
+#include "tx_queue.h"
+#include "tx_cache.h"
+#include "link_quality.h"
+#include "transport.h"
+#include "stream.h"
+#include "lbt.h"
+#include "id_check.h"
+#include "rfc8439.h"
+#include "beamform.h"
+#include "listen.h"
+#include "trace.h"
+#include "sdk_mem.h"
+#include "warm_state.h"
+#include "soak.h"
+#include "load_shed.h"
 
 static const char *TAG = "main";
 
@@ -61,25 +79,41 @@ static const char *TAG = "main";
 #define EG_SDK_PLAY_TASK_REQ_BIT    (1<<4)
 #define EG_SDK_TRILL_TASK_REQ_BIT   (1<<5)
 
+#if CONFIG_TRILL_SDK_VARIANT_SIZE
+#define TRILL_SDK_VARIANT_NAME      "size"
+#elif CONFIG_TRILL_SDK_VARIANT_SPEED
+#define TRILL_SDK_VARIANT_NAME      "speed"
+#elif CONFIG_TRILL_SDK_VARIANT_CUSTOM
+#define TRILL_SDK_VARIANT_NAME      CONFIG_TRILL_SDK_CUSTOM_LIB
+#else
+#define TRILL_SDK_VARIANT_NAME      "default"
+#endif
+
 #define FIRST_MSG_FROM_BOARD        "Hello from s3-box!"
 
 static int16_t* input_samples;
 static int16_t* output_samples;
 static trill_init_opts_t trill_init_opts;
 static int tx_audio_enabled;
-static trill_tx_params_t last_tx_params;
+static trill_tx_params_t default_tx_params;
 static EventGroupHandle_t eg_sdk_tasks_ctrl;
 
 
-static char last_rx_data[TRILL_MAX_DATA_PAYLOAD_LEN+1];
+// Render governor state. Written by SDK tasks, read by UI loop.
+static volatile int sdk_demod_active;
+static volatile unsigned int sdk_rx_deadline_misses;
+static unsigned int gov_frames_skipped;
+static unsigned int gov_demod_packets;
 
 static void* trill_handle;
+static const char* volatile provisioned_license;
 
-static void provision_license(void);
+static int provision_license(void);
 static int start_sdk_tasks(void);
 static int stop_sdk_tasks(void);
 static int sdk_on_off(void);
 static int do_init_trill(void);
+static int init_trill_with_license(const char* b64_license);
 
 static unsigned int print_mem_free_info(void)
 {
@@ -104,31 +138,131 @@ static void board_audio_tx_enable_cb(int enable)
 {
     tx_audio_enabled = enable ? 1 : 0;
 
-    ui_en_echo(!enable);
+    // Between packets of a burst or a long message 
+    // echo is re-enabled by tx_done_cb / xport_tx_done_cb.
+    if (enable || (!tx_queue_in_burst() && !xport_tx_busy()))
+    {
+        ui_post_en_echo(!enable);
+    }
 
     printf("board_audio_tx_enable_cb, TX: %s\n", enable ? "ENABLED": "DISABLED");
 }
 
 static int send_callback(void)
 {
-    int msg_len = strlen(last_rx_data);
+    trill_tx_params_t tx_params = default_tx_params;
+    unsigned char* msg = (unsigned char*) FIRST_MSG_FROM_BOARD;
+    int msg_len = strlen(FIRST_MSG_FROM_BOARD);
+
+    // Echo will work even if no messages were received.
+    const rx_buf_t* rx = ui_get_shown_rx_buf();
+    if (rx)
+    {
+        msg = (unsigned char*) rx->data;
+        msg_len = rx->len;
+        tx_params.ssi = rx->ssi;
+    }
+
+    tx_params.data_cfg_range = link_rate_select();
 
     printf("Attemping to send msg with len: %d\n", msg_len);
-    int ret = trill_tx_data(trill_handle, &last_tx_params, (uint8_t*) last_rx_data, msg_len);
+    int ret = tx_queue_send(&tx_params, msg, msg_len, NULL);
+    if (ret < 0)
+    {
+        printf("tx_queue_send failed: %d\n", ret);
+    }
+
+    return ret;
+}
+
+static int send_long_callback(void)
+{
+    static uint8_t msg[XPORT_MAX_MSG_LEN / 2];
+    trill_tx_params_t tx_params = default_tx_params;
+    int n = 0;
+
+    // Numbered text lines, easy to check on receiver side.
+    for (int line = 0; n < (sizeof(msg) - 32); line++)
+    {
+        n += sprintf((char*) &msg[n], "%s #%d\n", FIRST_MSG_FROM_BOARD, line);
+    }
+
+    tx_params.data_cfg_range = link_rate_select();
+
+    printf("Sending long msg with len: %d\n", n);
+    int ret = xport_send(&tx_params, msg, n);
     if (ret < 0)
     {
-        printf("trill_tx_data failed: %d\n", ret);
+        printf("xport_send failed: %d\n", ret);
     }
 
     return ret;
 }
 
+static void xport_rx_cb(const uint8_t* msg, unsigned int len)
+{
+    printf("xport: received msg with len %u: %.*s\n", len, 
+        len > 64 ? 64 : len, msg);
+}
+
+static void xport_tx_done_cb(int result)
+{
+    printf("xport: send done: %d\n", result);
+    ui_post_en_echo(1);
+}
+
+static void stream_rx_cb(const stream_chunk_t* chunk)
+{
+    printf("stream %u: +%u bytes at %u, lost %u, crc %s%s\n", chunk->id,
+        chunk->len, chunk->offset, chunk->lost, chunk->crc_ok ? "ok" : "unchecked",
+        chunk->last ? ", end" : "");
+}
+
+static void id_check_report_cb(const id_check_report_t* report)
+{
+    printf("id check: replied at range %d = %d, %lld ms after request, %u dropped\n",
+        report->range, report->result, report->latency_us / 1000, report->n_dropped);
+}
+
+static int start_id_check(void)
+{
+    static char info[64];
+    id_check_cfg_t cfg;
+    uint8_t mac[6] = {0};
+
+    esp_efuse_mac_get_default(mac);
+    cfg.info_len = snprintf(info, sizeof(info), 
+        "s3-box %02x%02x%02x%02x%02x%02x app %s sdk %s",
+        mac[0], mac[1], mac[2], mac[3], mac[4], mac[5], 
+        APP_VERSION, TRILL_SDK_VERSION);
+    cfg.info = (const uint8_t*) info;
+    cfg.ssi = default_tx_params.ssi;
+    cfg.ck_nonce = default_tx_params.ck_nonce;
+    cfg.range = link_rate_select();
+
+    return id_check_init(&cfg, id_check_report_cb);
+}
+
+static void tx_done_cb(unsigned int id, int result)
+{
+    printf("TX packet %u done: %d\n", id, result);
+    id_check_on_tx_done(id, result);
+    tx_cache_print_stats();
+
+    if (!tx_queue_in_burst() && !xport_tx_busy())
+    {
+        ui_post_en_echo(1);
+    }
+}
+
 void play_task(void *arg)
 {
     int ret;
     int16_t* tx_data = NULL;
     size_t i2s_bytes_written = 0;
     size_t input_size = 0;
+    int from_cache;
+    static int16_t cached_block[BLOCK_N_SAMPLES];
     
     printf("Starting play task.\n");
 
@@ -141,16 +275,34 @@ void play_task(void *arg)
         0) & EG_SDK_PLAY_TASK_REQ_BIT) == 0
     )
     {
-        ret = trill_acquire_audio_block(trill_handle, &tx_data, 0);
-        if (ret < 0)
+        from_cache = tx_cache_play_block(cached_block, BLOCK_N_SAMPLES);
+        if (from_cache)
+        {
+            tx_data = cached_block;
+        }
+        else
         {
-            if (ret != TRILL_ERR_AUDIO_TX_BLOCK_NOT_AVAILABLE)
+            TRACE_BEGIN(TRACE_PLAY_SDK_ACQUIRE);
+            ret = trill_acquire_audio_block(trill_handle, &tx_data, 0);
+            TRACE_END(TRACE_PLAY_SDK_ACQUIRE);
+            if (ret < 0)
             {
-                printf("trill_acquire_audio_block = %d\n", ret);
+                if (ret != TRILL_ERR_AUDIO_TX_BLOCK_NOT_AVAILABLE)
+                {
+                    printf("trill_acquire_audio_block = %d\n", ret);
+                }
+                else
+                {
+                    tx_cache_sdk_idle();
+                    vTaskDelay(pdMS_TO_TICKS(10));
+                    continue;
+                }
             }
-            else
+
+            if (tx_cache_sdk_block(tx_data, BLOCK_N_SAMPLES))
             {
-                vTaskDelay(pdMS_TO_TICKS(10));
+                // Block was only needed for waveform cache.
+                trill_release_audio_block(trill_handle);
                 continue;
             }
         }
@@ -162,14 +314,20 @@ void play_task(void *arg)
             output_samples[i+1] = tx_data[n];
         }
 
-        trill_release_audio_block(trill_handle);
+        if (!from_cache)
+        {
+            trill_release_audio_block(trill_handle);
+        }
+
         input_size = OUTPUT_SAMPLES_BUFFER_SIZE;
 
+        TRACE_BEGIN(TRACE_PLAY_I2S);
         i2s_write(I2S_NUM_0, 
             output_samples, 
             input_size, 
             &i2s_bytes_written, 
             portMAX_DELAY);
+        TRACE_END(TRACE_PLAY_I2S);
     }
 
     printf("play task stopped\n");
@@ -178,9 +336,59 @@ void play_task(void *arg)
     vTaskDelete(NULL);
 }
 
+// Span of trill_process is named after the stage it ran.
+static inline void trace_process_end(int ret)
+{
+    if (ret == TRILL_PROC_CTS_SEARCH)
+        TRACE_END(TRACE_SDK_CTS_SEARCH);
+    else if (ret == TRILL_PROC_DEMOD_PROGRESS)
+        TRACE_END(TRACE_SDK_DEMOD);
+    else if (ret == TRILL_PROC_MOD_PACKET_SENT)
+        TRACE_END(TRACE_SDK_PACKET_SENT);
+    else
+        TRACE_END(TRACE_SDK_ERROR);
+}
+
+#if CONFIG_TRILL_SDK_IRAM_HOT
+#define TRILL_SDK_IRAM_HOT_NAME     "ON"
+#else
+#define TRILL_SDK_IRAM_HOT_NAME     "OFF"
+#endif
+
+/*
+    Worst case trill_process call per stage over a report period.
+    Compare runs with CONFIG_TRILL_SDK_IRAM_HOT on and off
+    while the UI is animating.
+*/
+static void proc_latency_update(int ret, int64_t t_us)
+{
+    static int64_t max_cts_us;
+    static int64_t max_demod_us;
+    static int64_t report_us;
+    int64_t now = trace_now_us();
+
+    if (ret == TRILL_PROC_CTS_SEARCH && (now - t_us) > max_cts_us)
+        max_cts_us = now - t_us;
+    else if (ret == TRILL_PROC_DEMOD_PROGRESS && (now - t_us) > max_demod_us)
+        max_demod_us = now - t_us;
+
+    if ((now - report_us) >= APP_PROC_LATENCY_REPORT_MS * 1000LL)
+    {
+        if (report_us)
+        {
+            printf("trill_process max: cts search %lld us, demod %lld us (iram hot: %s)\n",
+                max_cts_us, max_demod_us, TRILL_SDK_IRAM_HOT_NAME);
+        }
+        max_cts_us = 0;
+        max_demod_us = 0;
+        report_us = now;
+    }
+}
+
 void trill_task(void *arg)
 {
     int ret;
+    int64_t t_us;
 
     (void) arg;
 
@@ -193,9 +401,24 @@ void trill_task(void *arg)
         0) & EG_SDK_TRILL_TASK_REQ_BIT) == 0
     )
     {
+        TRACE_BEGIN(TRACE_TRILL_PROCESS);
+        t_us = trace_now_us();
         ret = trill_process(trill_handle);
+        trace_process_end(ret);
+        if (APP_PROC_LATENCY_REPORT_MS)
+        {
+            proc_latency_update(ret, t_us);
+        }
+        sdk_demod_active = (ret == TRILL_PROC_DEMOD_PROGRESS);
+        if (sdk_demod_active)
+        {
+            lbt_note_demod();
+        }
         if (ret < 0)
         {
+            link_quality_on_rx_error(ret);
+            listen_on_rx_error(ret);
+
             if (ret == TRILL_ERR_USER_ABORTED_TX)
             {
                 printf("trill_process_input: App requested tx abort.\n");    
@@ -212,17 +435,77 @@ void trill_task(void *arg)
     vTaskDelete(NULL);
 }
 
+/*
+    Every captured block, also those listen mode keeps from the SDK, so
+    beam steering history, beam quiet level and link noise floor see the
+    room as it is, not only blocks loud enough to wake.
+*/
+static void front_end_block(int16_t* block, int beam_en)
+{
+    int demod = sdk_demod_active;
+    load_shed_level_t shed = load_shed_update();
+    int64_t t0 = trace_now_us();
+
+    // Steered sum of both mics replaces channel 0.
+    if (beam_en)
+    {
+        TRACE_BEGIN(TRACE_FEED_BEAM);
+        beamform_set_load(shed);
+        beamform_process(block, BLOCK_N_SAMPLES, N_MICS_ON_BOARD, demod);
+        TRACE_END(TRACE_FEED_BEAM);
+    }
+
+    link_quality_feed_block(block, BLOCK_N_SAMPLES, 
+        N_MICS_ON_BOARD, 0, demod);
+
+    load_shed_work_done(trace_now_us() - t0);
+}
+
+static void feed_sdk_block(int16_t* block)
+{
+    int ret;
+    int demod = sdk_demod_active;
+    int64_t t0 = trace_now_us();
+
+    TRACE_BEGIN(TRACE_FEED_BLOCK);
+
+    TRACE_BEGIN(TRACE_FEED_SDK_ADD);
+    ret = trill_add_audio_block(trill_handle, block);
+
+    // Any block may hold packet audio, give trill task time to free one.
+    while ((ret < 0) && ((trace_now_us() - t0) < APP_SHED_RETRY_US))
+    {
+        load_shed_note_retry();
+        vTaskDelay(1);
+        ret = trill_add_audio_block(trill_handle, block);
+    }
+    TRACE_END(TRACE_FEED_SDK_ADD);
+
+    TRACE_END(TRACE_FEED_BLOCK);
+
+    load_shed_on_add(ret, demod);
+
+    if (ret < 0)
+    {
+        // Decoder did not keep up with the audio, app work is shed now.
+        printf("%u) trill_add_audio_block = %d\n", sdk_rx_deadline_misses++, ret);
+    }
+}
+
 void feed_task(void *arg)
 {
     int ret;
-    size_t err_count = 0;
     int feed_channels = N_MICS_ON_BOARD;
     unsigned int rx_block_size = BLOCK_N_SAMPLES * sizeof(int16_t) * feed_channels;
     
     int16_t *audio_rx_buff = heap_caps_malloc(rx_block_size, MALLOC_CAP_INTERNAL);
     assert(audio_rx_buff);
+
+    int beam_en = APP_BEAM_EN && (beamform_init(BLOCK_N_SAMPLES) == 0);
+    int listen_en = APP_LISTEN_EN && (listen_init(BLOCK_N_SAMPLES, feed_channels) == 0);
     
-    printf("Starting audio rx task. channels=%d\n", feed_channels);
+    printf("Starting audio rx task. channels=%d beam=%d listen=%d\n", 
+        feed_channels, beam_en, listen_en);
 
     while (
         (xEventGroupWaitBits(
@@ -234,6 +517,8 @@ void feed_task(void *arg)
         )
     {
         size_t bytes_read = 0;
+        int tx_busy;
+        listen_state_t listen = LISTEN_AWAKE;
 
         /* Read audio data from I2S bus */
         ret = i2s_read(I2S_NUM_0, audio_rx_buff, 
@@ -243,20 +528,53 @@ void feed_task(void *arg)
         {
             printf("i2s_read failed = %d\n", ret);
         }
+
+        // Still listening while TX queue waits for a clear channel
+        // or modulates a packet without playing it.
+        tx_busy = (tx_audio_enabled && !tx_queue_preparing()) || tx_queue_on_air();
+        if (!tx_busy)
+        {
+            lbt_feed_block(audio_rx_buff, BLOCK_N_SAMPLES, feed_channels);
+            front_end_block(audio_rx_buff, beam_en);
+        }
+
+        // Pre-roll keeps blocks already through the front end.
+        if (listen_en)
+        {
+            listen = listen_block(audio_rx_buff, sdk_demod_active, tx_busy);
+        }
         
         // feed input only when tx is not in progress.
         // but keep clearing audio data from ADC.
-        if (!tx_audio_enabled)
+        if (tx_busy || (listen == LISTEN_SLEEP))
         {
-            ret = trill_add_audio_block(trill_handle, audio_rx_buff);
-            if (ret < 0)
+            continue;
+        }
+
+        if (listen == LISTEN_WAKE)
+        {
+            int16_t* pre;
+
+            TRACE_INSTANT(TRACE_FEED_WAKE);
+
+            // Blocks leading up to the wake, may hold start of CTS.
+            while ((pre = listen_preroll_pop()) != NULL)
             {
-                printf("%u) trill_add_audio_block = %d\n", err_count++, ret);
-                vTaskDelay(pdMS_TO_TICKS(1000));
+                feed_sdk_block(pre);
             }
         }
+
+        feed_sdk_block(audio_rx_buff);
     }
 
+    if (listen_en)
+    {
+        listen_print_stats();
+        listen_deinit();
+    }
+    load_shed_print_stats();
+    lbt_print_stats();
+    beamform_deinit();
     free(audio_rx_buff);
     xEventGroupSetBits(eg_sdk_tasks_ctrl, EG_SDK_FEED_TASK_STOP_BIT);
 
@@ -267,45 +585,57 @@ void feed_task(void *arg)
 
 static void log_print(const char* data)
 {
+#if CONFIG_TRILL_SDK_LOG
 	printf("%s", data);
+#else
+    (void) data;
+#endif
 }
 
 static unsigned long timer_us(void)
 {
-    return (dsp_get_cpu_cycle_count() * 0.00416666666); // cpu clock 240MHz.
+    // SDK takes differences, truncation wraps cleanly.
+    return (unsigned long) trace_now_us();
 }
 
 static void data_link_evt_handler(const trill_data_link_event_params_t* params)
 {
 	static int count = 0;
+    rx_buf_t* rx_buf;
     
 	switch(params->event)
 	{
 		case TRILL_DATA_LINK_EVT_DATA_RCVD:
             count++;
-			printf("chn-%d: data-link event = %d, RX SSI%d, PLen: %d, payload content: %.*s\n",
-                params->channel,
-                params->event, params->ssi, 
-                params->payload_len,
-                params->payload_len, params->payload);
-
-            memset(last_rx_data, 0, sizeof(last_rx_data));
-            last_tx_params.ssi = params->ssi;
-            last_tx_params.data_cfg_range = params->data_cfg_range;
-                
-            // send only ascii chars to ui.
-            for (int i = 0; (i < params->payload_len) && (i < (sizeof(last_rx_data)-1)); i++)
+            TRACE_INSTANT(TRACE_RX_PACKET);
+            listen_on_rx();
+
+            if (xport_on_rx(params->payload, params->payload_len) ||
+                stream_on_rx(params->payload, params->payload_len))
             {
-                if (params->payload[i] < 127)
-                    last_rx_data[i] = (char) params->payload[i];
-                else
-                    last_rx_data[i] = '-';
+                break;
             }
-                
-            ui_set_rx_msg(last_rx_data);
+
+            // Single copy out of SDK memory, shared by reference from here.
+            rx_buf = rx_buf_from_event(params);
+            if (rx_buf == NULL)
+            {
+                printf("RX pool exhausted (%u), packet dropped\n", 
+                    rx_pool_exhausted_count());
+                break;
+            }
+
+            // Runs in trill task, keep it short. Drawn from UI loop.
+            ui_post_rx_buf(rx_buf);
+            break;
+		case TRILL_DATA_LINK_EVT_ID_CHECK_REQ:
+            // Answered from here, no round trip through UI loop.
+            id_check_on_req(params);
             break;
 		case TRILL_DATA_LINK_EVT_DATA_SENT:
+			TRACE_INSTANT(TRACE_TX_SENT);
 			printf("Packet sent with length: %d\n", params->payload_len);
+            tx_queue_on_sent();
             break;
 		default:
 			printf("Unknown data link event");
@@ -313,36 +643,6 @@ static void data_link_evt_handler(const trill_data_link_event_params_t* params)
 	}
 }
 
-static inline void* tsdk_mem_alloc(size_t size)
-{
-    return heap_caps_malloc(size, MALLOC_CAP_INTERNAL);
-}
-
-static inline void tsdk_mem_free(void* ptr)
-{
-    if (ptr == NULL)
-    {
-        printf("***Trying to free NULL pointer***\n");
-    }
-
-    free(ptr);
-}
-
-static inline void* tsdk_mem_aligned_alloc(unsigned int alignment, size_t size)
-{
-    if (alignment != 16)
-    {
-        return heap_caps_aligned_alloc(alignment, size, MALLOC_CAP_SPIRAM);
-    }
-    else
-    {
-        // ESP-DSP blocks need 16 byte alignment buffers.
-        // Allocate them in internal memory for better performance.
-        return heap_caps_aligned_alloc(alignment, size, MALLOC_CAP_INTERNAL);
-    }
-    
-}
-
 static int sdk_on_off(void)
 {
     int ret;
@@ -380,6 +680,27 @@ static int start_sdk_tasks(void)
         }
     }
 
+    // Quiet levels and TX range of last run, else TX starts with
+    // the most robust range until packets are seen.
+    if (APP_WARM_EN)
+    {
+        warm_state_load();
+    }
+    link_quality_reset();
+    load_shed_reset(CONFIG_TRILL_SDK_RX_AUDIO_BLOCKS);
+
+    ret = xport_init(xport_rx_cb, xport_tx_done_cb);
+    if (ret < 0)
+    {
+        return ret;
+    }
+
+    ret = stream_init(stream_rx_cb);
+    if (ret < 0)
+    {
+        return ret;
+    }
+
     ret = xTaskCreatePinnedToCore(
             &feed_task, // func code
             "feed", // name
@@ -409,12 +730,24 @@ static int start_sdk_tasks(void)
         return -1;
     }
 
-    // Echo will work even if no messages were received.
-    strcpy(last_rx_data, FIRST_MSG_FROM_BOARD);
+    ret = tx_queue_start(trill_handle, tx_done_cb);
+    if (ret < 0)
+    {
+        return ret;
+    }
 
-    last_tx_params.ssi = SSI_PLAIN_TEXT;
-    last_tx_params.ck_nonce = NULL;
-    last_tx_params.data_cfg_range = TRILL_DATA_CFG_RANGE_FAR;
+    default_tx_params.ssi = SSI_PLAIN_TEXT;
+    default_tx_params.ck_nonce = NULL;
+    default_tx_params.data_cfg_range = TRILL_DATA_CFG_RANGE_FAR;
+
+    if (APP_ID_CHECK_EN)
+    {
+        ret = start_id_check();
+        if (ret < 0)
+        {
+            return ret;
+        }
+    }
 
     return 0;
 }
@@ -423,6 +756,10 @@ static int stop_sdk_tasks(void)
 {
     int ret;
 
+    // Drop queued packets first so nothing new is started.
+    tx_queue_stop();
+    id_check_deinit();
+
     if (tx_audio_enabled)
     {
         ret = trill_tx_abort(trill_handle);
@@ -458,21 +795,34 @@ static int stop_sdk_tasks(void)
         pdTRUE,
         portMAX_DELAY);
 
+    if (APP_WARM_EN)
+    {
+        warm_state_save();
+    }
+
     printf("Before trill_deinit\n");
     print_mem_free_info();
+    sdk_mem_report();
     ret = trill_deinit(trill_handle);
     printf("After trill_deinit = %d\n", ret);
     print_mem_free_info();
 
     trill_handle = NULL;
 
+    if (APP_TRACE_EN)
+    {
+        trace_dump();
+    }
+
     return ret;
 }
 
-static int do_init_trill(void)
+/* License file into a malloc'd string, caller frees it. */
+static int read_license(char** lic)
 {
     int ret;
-    
+
+    *lic = NULL;
     printf("Using License file: %s\n", TRILLBIT_LICENSE_PATH);
     
     FILE* fp = fopen(TRILLBIT_LICENSE_PATH, "r");
@@ -486,7 +836,7 @@ static int do_init_trill(void)
     size_t length = ftell(fp);
     fseek(fp, 0L, SEEK_SET);
 
-    char* lic_buf = malloc(length);
+    char* lic_buf = malloc(length + 1);
 
     if (!lic_buf)
     {
@@ -498,54 +848,338 @@ static int do_init_trill(void)
     if ((ret = fread(lic_buf, length, 1, fp)) != 1)
     {
         printf("Failed to read license file: %d %u\n", ret, length);
+        free(lic_buf);
         ret = -1;
         goto err;
     }
 
+    lic_buf[length] = '\0';
     printf("Loaded License: %s\n", lic_buf);
-	
-    trill_init_opts.n_rx_channels = N_MICS_ON_BOARD;
+    *lic = lic_buf;
+    ret = 0;
+
+err:
+
+    fclose(fp);
+    return ret;
+}
+
+static int do_init_trill(void)
+{
+    char* lic_buf;
+    int ret;
+    
+    printf("Trill SDK v%s, library variant: %s, rx blocks: %d, tx blocks: %d\n",
+        TRILL_SDK_VERSION, TRILL_SDK_VARIANT_NAME,
+        CONFIG_TRILL_SDK_RX_AUDIO_BLOCKS, CONFIG_TRILL_SDK_TX_AUDIO_BLOCKS);
+
+    ret = read_license(&lic_buf);
+    if (ret < 0)
+    {
+        return ret;
+    }
+
+    ret = init_trill_with_license(lic_buf);
+
+    free(lic_buf);
+    return ret;
+}
+
+static volatile unsigned int test_rx_packets;
+
+/* Callbacks of SDK instances created only for tests, before the UI runs. */
+static void test_audio_tx_enable_cb(int enable)
+{
+    (void) enable;
+}
+
+static void test_data_link_cb(const trill_data_link_event_params_t* params)
+{
+    if (params->event == TRILL_DATA_LINK_EVT_DATA_RCVD)
+    {
+        test_rx_packets++;
+    }
+}
+
+/*
+    Second instance on the same init options next to trill_handle, before
+    SDK tasks run. The second one modulates a packet and demodulates its
+    own TX blocks looped back, so tables see TX and demod time writes,
+    while the first one is fed silence. Shared tables must still match,
+    the packet must be received and the second instance must have cost 
+    less by the bytes shared.
+*/
+static int sdk_share_test(unsigned int used_first)
+{
+    void* handle2 = NULL;
+    trill_init_opts_t opts = trill_init_opts;
+    trill_tx_params_t params;
+    int16_t* block;
+    int16_t* silence;
+    int16_t* wave;
+    int16_t* tx;
+    unsigned int free_before, used_second, saved;
+    unsigned int n_wave = 0;
+    int ret, n_bad;
+
+    block = heap_caps_calloc(BLOCK_N_SAMPLES * N_MICS_ON_BOARD, sizeof(int16_t), 
+                MALLOC_CAP_SPIRAM);
+    silence = heap_caps_calloc(BLOCK_N_SAMPLES * N_MICS_ON_BOARD, sizeof(int16_t), 
+                MALLOC_CAP_SPIRAM);
+    wave = heap_caps_malloc(APP_SDK_SHARE_TEST_BLOCKS * BLOCK_N_SAMPLES * sizeof(int16_t), 
+                MALLOC_CAP_SPIRAM);
+    if ((block == NULL) || (silence == NULL) || (wave == NULL))
+    {
+        free(block);
+        free(silence);
+        free(wave);
+        return -1;
+    }
+
+    opts.audio_tx_enable_fn = test_audio_tx_enable_cb;
+    opts.data_link_cb = test_data_link_cb;
+
+    free_before = heap_caps_get_free_size(MALLOC_CAP_DEFAULT);
+    sdk_mem_share_begin();
+    ret = trill_init(&opts, &handle2);
+    n_bad = sdk_mem_share_end();
+    used_second = free_before - heap_caps_get_free_size(MALLOC_CAP_DEFAULT);
+    saved = sdk_mem_shared_saved();
+
+    if ((ret == 0) && (n_bad > 0))
+    {
+        printf("share test: FAIL, %d tables written differently by init\n", n_bad);
+        trill_deinit(handle2);
+        ret = -1;
+    }
+
+    if (ret < 0)
+    {
+        printf("share test: second trill_init = %d\n", ret);
+        free(block);
+        free(silence);
+        free(wave);
+        return ret;
+    }
+
+    params.ssi = SSI_PLAIN_TEXT;
+    params.ck_nonce = NULL;
+    params.data_cfg_range = TRILL_DATA_CFG_RANGE_NEAR;
+    test_rx_packets = 0;
+
+    ret = trill_tx_data(handle2, &params, 
+            (unsigned char*) FIRST_MSG_FROM_BOARD, strlen(FIRST_MSG_FROM_BOARD));
+    if (ret < 0)
+    {
+        printf("share test: trill_tx_data = %d\n", ret);
+    }
+
+    // Modulate the whole packet first, RX is off while SDK sends.
+    for (int i = 0; i < APP_SDK_SHARE_TEST_BLOCKS; i++)
+    {
+        trill_process(handle2);
+        while (trill_acquire_audio_block(handle2, &tx, 0) == 0)
+        {
+            if (n_wave < APP_SDK_SHARE_TEST_BLOCKS)
+            {
+                memcpy(&wave[n_wave * BLOCK_N_SAMPLES], tx, BLOCK_N_SAMPLES * sizeof(int16_t));
+                n_wave++;
+            }
+            trill_release_audio_block(handle2);
+        }
+    }
+
+    // Then back as RX on both mics, with silence after it.
+    for (int i = 0; i < APP_SDK_SHARE_TEST_BLOCKS; i++)
+    {
+        memset(block, 0, BLOCK_N_SAMPLES * N_MICS_ON_BOARD * sizeof(int16_t));
+        for (int n = 0; (i < n_wave) && (n < BLOCK_N_SAMPLES); n++)
+        {
+            block[N_MICS_ON_BOARD * n] = wave[i * BLOCK_N_SAMPLES + n];
+            block[N_MICS_ON_BOARD * n + 1] = wave[i * BLOCK_N_SAMPLES + n];
+        }
+
+        trill_add_audio_block(trill_handle, silence);
+        trill_add_audio_block(handle2, block);
+        trill_process(trill_handle);
+        trill_process(handle2);
+    }
+
+    n_bad += sdk_mem_share_verify();
+
+    printf("share test: first instance %u bytes, second %u bytes, tables shared %u bytes\n",
+        used_first, used_second, saved);
+    printf("share test: %s, %d shared tables differ, %u TX blocks, %u packets received\n", 
+        (n_bad == 0 && saved > 0 && test_rx_packets > 0) ? "PASS" : "FAIL", 
+        n_bad, n_wave, test_rx_packets);
+
+    trill_deinit(handle2);
+    free(block);
+    free(silence);
+    free(wave);
+
+    return ((n_bad == 0) && (test_rx_packets > 0)) ? 0 : -1;
+}
+
+/* Options of the app's instance, callbacks included. */
+static void set_trill_opts(trill_init_opts_t* opts, const char* b64_license)
+{
+    memset(opts, 0, sizeof(*opts));
+    opts->n_rx_channels = N_MICS_ON_BOARD;
     
     /*
         Bits     7 6 5 4 3 2 1 0
         Channels 7 6 5 4 3 2 1 0
         Enabled  0 0 0 0 0 0 0 1
     */
-    trill_init_opts.rx_channels_en_bm = 1; 
-    trill_init_opts.aud_buf_rx_block_size_bytes = INPUT_SAMPLES_BLOCK_SIZE;
-	trill_init_opts.aud_buf_rx_n_blocks = 20;
-	trill_init_opts.aud_buf_rx_notify_cb = NULL;
-
-	trill_init_opts.aud_buf_tx_block_size_bytes = OUTPUT_SAMPLES_BUFFER_SIZE / I2S_CHANNEL_NUM;
-	trill_init_opts.aud_buf_tx_n_blocks = 2;
-	trill_init_opts.aud_buf_tx_notify_cb = NULL;
-
-	trill_init_opts.audio_tx_enable_fn = board_audio_tx_enable_cb;
-	trill_init_opts.data_link_cb = data_link_evt_handler;
+    opts->rx_channels_en_bm = 1; 
+    opts->aud_buf_rx_block_size_bytes = INPUT_SAMPLES_BLOCK_SIZE;
+	opts->aud_buf_rx_n_blocks = CONFIG_TRILL_SDK_RX_AUDIO_BLOCKS;
+	opts->aud_buf_rx_notify_cb = load_shed_on_rx_buf;
+
+	opts->aud_buf_tx_block_size_bytes = OUTPUT_SAMPLES_BUFFER_SIZE / I2S_CHANNEL_NUM;
+	opts->aud_buf_tx_n_blocks = CONFIG_TRILL_SDK_TX_AUDIO_BLOCKS;
+	opts->aud_buf_tx_notify_cb = NULL;
+
+    // Audio rings are the only SDK buffers of known size.
+    sdk_mem_expect(SDK_MEM_AUDIO_RX, 
+        opts->aud_buf_rx_block_size_bytes * opts->aud_buf_rx_n_blocks);
+    sdk_mem_expect(SDK_MEM_AUDIO_TX, 
+        opts->aud_buf_tx_block_size_bytes * opts->aud_buf_tx_n_blocks);
+    sdk_mem_expect(SDK_MEM_AUDIO_RX, opts->aud_buf_rx_block_size_bytes);
+    sdk_mem_expect(SDK_MEM_AUDIO_TX, opts->aud_buf_tx_block_size_bytes);
+
+	opts->audio_tx_enable_fn = board_audio_tx_enable_cb;
+	opts->data_link_cb = data_link_evt_handler;
+
+	opts->b64_ck = NULL;
+	opts->b64_ck_nonce = NULL;
+	opts->b64_license = b64_license;
+
+	opts->mem_alloc_fn = sdk_mem_alloc;
+    opts->mem_aligned_alloc_fn = sdk_mem_aligned_alloc;
+	opts->mem_free_fn = sdk_mem_free;
+	opts->logger_fn = log_print;
+	opts->timer_get_fn = timer_us;
+}
 
-	trill_init_opts.b64_ck = NULL;
-	trill_init_opts.b64_ck_nonce = NULL;
-	trill_init_opts.b64_license = lic_buf;
+static int init_trill_with_license(const char* b64_license)
+{
+    int ret, n_bad;
+    unsigned int free_before, free_after;
 
-	trill_init_opts.mem_alloc_fn = tsdk_mem_alloc;
-    trill_init_opts.mem_aligned_alloc_fn = tsdk_mem_aligned_alloc;
-	trill_init_opts.mem_free_fn = tsdk_mem_free;
-	trill_init_opts.logger_fn = log_print;
-	trill_init_opts.timer_get_fn = timer_us;
+    set_trill_opts(&trill_init_opts, b64_license);
 
     printf("Before trill init\n");
-    print_mem_free_info();
+    free_before = print_mem_free_info();
+    sdk_mem_share_begin();
     ret = trill_init(&trill_init_opts, &trill_handle);
+    n_bad = sdk_mem_share_end();
+    if ((ret == 0) && (n_bad > 0))
+    {
+        // Tables of a live instance were not read-only, drop this one.
+        printf("trill_init: %d shared tables differ\n", n_bad);
+        trill_deinit(trill_handle);
+        ret = -1;
+    }
     printf("After trill_init = %d\n", ret);
-    print_mem_free_info();
-    
-err:
+    free_after = print_mem_free_info();
+    sdk_mem_report();
+    if (ret < 0)
+    {
+        trill_handle = NULL;
+    }
+    else if (APP_SDK_SHARE_TEST)
+    {
+        sdk_share_test(free_before - free_after);
+    }
 
-    free(lic_buf);
-    fclose(fp);
     return ret;
 }
 
+static const char* soak_license;
+
+/* SDK only: no board audio, UI or load shedding behind the callbacks. */
+static int soak_sdk_init(void** handle)
+{
+    trill_init_opts_t opts;
+
+    set_trill_opts(&opts, soak_license);
+    opts.aud_buf_rx_notify_cb = NULL;
+    opts.audio_tx_enable_fn = test_audio_tx_enable_cb;
+    opts.data_link_cb = test_data_link_cb;
+
+    return trill_init(&opts, handle);
+}
+
+static void soak_sdk_deinit(void* handle)
+{
+    trill_deinit(handle);
+}
+
+static void ui_loop_tick(void)
+{
+    static unsigned int demod_ticks;
+
+    if (sdk_demod_active)
+    {
+        demod_ticks++;
+        if (APP_UI_GOV_EN)
+        {
+            // Keep touch input alive at a lower rate, 
+            // defer label updates to after the packet.
+            if ((demod_ticks % APP_UI_GOV_DEMOD_TICK_DIV) != 0)
+            {
+                gov_frames_skipped++;
+            }
+            else
+            {
+                TRACE_BEGIN(TRACE_UI_RENDER);
+                lv_task_handler();
+                TRACE_END(TRACE_UI_RENDER);
+            }
+            return;
+        }
+    }
+    else if (demod_ticks)
+    {
+        demod_ticks = 0;
+        gov_demod_packets++;
+        printf("ui gov %s: demod packets: %u, frames skipped: %u, rx deadline misses: %u\n",
+            APP_UI_GOV_EN ? "ON" : "OFF",
+            gov_demod_packets,
+            gov_frames_skipped,
+            sdk_rx_deadline_misses);
+    }
+
+    if (APP_WARM_EN && trill_handle)
+    {
+        static int64_t warm_save_us;
+        int64_t now = trace_now_us();
+
+        if (warm_save_us == 0)
+        {
+            warm_save_us = now;
+        }
+        else if (((now - warm_save_us) >= APP_WARM_SAVE_PERIOD_S * 1000000LL) &&
+                 !sdk_demod_active && !tx_audio_enabled && !tx_queue_in_burst())
+        {
+            // Flash write stalls the cache and so the feed task,
+            // deferred while a packet is in the air either way.
+            warm_save_us = now;
+            warm_state_save();
+        }
+    }
+
+    xport_poll();
+    stream_poll();
+    ui_process_events();
+
+    TRACE_BEGIN(TRACE_UI_RENDER);
+    lv_task_handler();
+    TRACE_END(TRACE_UI_RENDER);
+}
+
 void app_main()
 {
     int ret;
@@ -574,6 +1208,41 @@ void app_main()
 
     printf("MCU/Device ID: %s\n", device_id);
 
+    if (APP_CRYPTO_SELF_TEST && (rfc8439_self_test() < 0))
+    {
+        return;
+    }
+
+    if (APP_TRACE_EN)
+    {
+        trace_init();
+    }
+
+    if (APP_LISTEN_EN)
+    {
+        listen_pm_init();
+    }
+
+    if (APP_SOAK_CYCLES)
+    {
+        soak_ops_t soak_ops = {
+            .init = soak_sdk_init,
+            .deinit = soak_sdk_deinit,
+            .n_samples = BLOCK_N_SAMPLES,
+            .n_channels = N_MICS_ON_BOARD,
+        };
+        char* lic_buf;
+
+        // Read once, file system buffers stay out of the heap samples.
+        if (read_license(&lic_buf) == 0)
+        {
+            soak_license = lic_buf;
+            soak_run(&soak_ops, APP_SOAK_CYCLES);
+            soak_license = NULL;
+            free(lic_buf);
+        }
+    }
+
     ret = do_init_trill();
     if (ret < 0)
     {
@@ -581,9 +1250,13 @@ void app_main()
             (ret == TRILL_ERR_LICENSE_NOT_FOR_THIS_DEVICE))
         {
             printf("Starting serial communication.\n");
-            provision_license();
+            ret = provision_license();
+        }
+
+        if (ret < 0)
+        {
+            return;
         }
-        return;
     }
 
     input_samples = heap_caps_malloc(INPUT_SAMPLES_BLOCK_SIZE, MALLOC_CAP_SPIRAM);
@@ -602,6 +1275,7 @@ void app_main()
     else
     {
         ui_set_echo_callback(send_callback);
+        ui_set_echo_long_callback(send_long_callback);
         ui_en_echo(1);
     }
 
@@ -614,12 +1288,25 @@ void app_main()
     ui_set_start_callback(sdk_on_off);
 
     do {
-        lv_task_handler();
+        TRACE_BEGIN(TRACE_UI_TICK);
+        ui_loop_tick();
+        TRACE_END(TRACE_UI_TICK);
     } while (vTaskDelay(1), true);
 }
 
 
-void provision_license(void)
+static int license_received_cb(const char* b64_license)
+{
+    // Runs in console task. Apply it from the UI loop.
+    provisioned_license = b64_license;
+    return 0;
+}
+
+/*
+    Returns once a license received over serial was accepted
+    by trill_init, with trill_handle initialized.
+*/
+static int provision_license(void)
 {
     int ret;
     const char* dev_id;
@@ -630,14 +1317,31 @@ void provision_license(void)
 
     lv_task_handler();
 
-    ret = ser_cmd_init();
+    ret = ser_cmd_init(license_received_cb);
     if (ret < 0)
     {
         printf("ser_cmd_init failed: %d\n", ret);
-        return;
+        return ret;
     }
 
     do {
         lv_task_handler();
+
+        if (provisioned_license)
+        {
+            ret = init_trill_with_license(provisioned_license);
+            provisioned_license = NULL;
+            ser_cmd_lic_result(ret);
+            if (ret == 0)
+            {
+                break;
+            }
+
+            printf("Provisioned license rejected: %d\n", ret);
+        }
     } while (vTaskDelay(1), true);
+
+    ser_cmd_deinit();
+
+    return 0;
 }
@@ -0,0 +1,458 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "esp_attr.h"
+#include "esp_heap_caps.h"
+#include "esp_dsp.h"
+
+#include "rfc8439.h"
+
+/*
+    Word oriented implementation. ChaCha20 keystream is XORed 32 bits at
+    a time and Poly1305 uses 26 bit limbs so every product fits the LX7
+    32x32->64 multiplier (MULL/MULUH) without carries between limbs.
+    Hot loops are placed in IRAM, away from flash cache misses caused by
+    LCD / PSRAM traffic on the other core.
+*/
+
+#define CHACHA_BLOCK_SIZE   64
+#define POLY_BLOCK_SIZE     16
+
+#define ROTL32(v, n)    (((v) << (n)) | ((v) >> (32 - (n))))
+
+#define QR(a, b, c, d) \
+    a += b; d ^= a; d = ROTL32(d, 16); \
+    c += d; b ^= c; b = ROTL32(b, 12); \
+    a += b; d ^= a; d = ROTL32(d, 8);  \
+    c += d; b ^= c; b = ROTL32(b, 7)
+
+static inline uint32_t load32(const uint8_t* p)
+{
+    // Xtensa traps on unaligned word loads, memcpy lets compiler pick.
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline void store32(uint8_t* p, uint32_t v)
+{
+    memcpy(p, &v, sizeof(v));
+}
+
+static void chacha20_init(uint32_t state[16], const uint8_t key[RFC_8439_KEY_SIZE], 
+        uint32_t counter, const uint8_t nonce[RFC_8439_NONCE_SIZE])
+{
+    state[0] = 0x61707865;
+    state[1] = 0x3320646e;
+    state[2] = 0x79622d32;
+    state[3] = 0x6b206574;
+    for (int i = 0; i < 8; i++)
+        state[4 + i] = load32(&key[4 * i]);
+    state[12] = counter;
+    state[13] = load32(&nonce[0]);
+    state[14] = load32(&nonce[4]);
+    state[15] = load32(&nonce[8]);
+}
+
+static IRAM_ATTR void chacha20_block(const uint32_t in[16], uint32_t out[16])
+{
+    uint32_t x0 = in[0], x1 = in[1], x2 = in[2], x3 = in[3];
+    uint32_t x4 = in[4], x5 = in[5], x6 = in[6], x7 = in[7];
+    uint32_t x8 = in[8], x9 = in[9], x10 = in[10], x11 = in[11];
+    uint32_t x12 = in[12], x13 = in[13], x14 = in[14], x15 = in[15];
+
+    // Locals so the compiler keeps the whole state in the register window.
+    for (int i = 0; i < 10; i++)
+    {
+        QR(x0, x4, x8, x12);
+        QR(x1, x5, x9, x13);
+        QR(x2, x6, x10, x14);
+        QR(x3, x7, x11, x15);
+        QR(x0, x5, x10, x15);
+        QR(x1, x6, x11, x12);
+        QR(x2, x7, x8, x13);
+        QR(x3, x4, x9, x14);
+    }
+
+    out[0] = x0 + in[0];    out[1] = x1 + in[1];
+    out[2] = x2 + in[2];    out[3] = x3 + in[3];
+    out[4] = x4 + in[4];    out[5] = x5 + in[5];
+    out[6] = x6 + in[6];    out[7] = x7 + in[7];
+    out[8] = x8 + in[8];    out[9] = x9 + in[9];
+    out[10] = x10 + in[10]; out[11] = x11 + in[11];
+    out[12] = x12 + in[12]; out[13] = x13 + in[13];
+    out[14] = x14 + in[14]; out[15] = x15 + in[15];
+}
+
+static IRAM_ATTR void chacha20_xor(uint8_t* dst, const uint8_t* src, size_t len,
+        const uint8_t key[RFC_8439_KEY_SIZE], uint32_t counter,
+        const uint8_t nonce[RFC_8439_NONCE_SIZE])
+{
+    uint32_t state[16];
+    uint32_t ks[16];
+
+    chacha20_init(state, key, counter, nonce);
+
+    while (len >= CHACHA_BLOCK_SIZE)
+    {
+        chacha20_block(state, ks);
+        state[12]++;
+
+        for (int i = 0; i < 16; i++)
+            store32(&dst[4 * i], load32(&src[4 * i]) ^ ks[i]);
+
+        dst += CHACHA_BLOCK_SIZE;
+        src += CHACHA_BLOCK_SIZE;
+        len -= CHACHA_BLOCK_SIZE;
+    }
+
+    if (len)
+    {
+        uint8_t tail[CHACHA_BLOCK_SIZE];
+
+        chacha20_block(state, ks);
+        memcpy(tail, ks, sizeof(tail));
+        for (size_t i = 0; i < len; i++)
+            dst[i] = src[i] ^ tail[i];
+    }
+}
+
+typedef struct {
+    uint32_t r[5];
+    uint32_t h[5];
+    uint32_t pad[4];
+    uint8_t buf[POLY_BLOCK_SIZE];
+    size_t buf_len;
+} poly1305_t;
+
+static void poly1305_init(poly1305_t* st, const uint8_t key[32])
+{
+    // r &= 0xffffffc0ffffffc0ffffffc0fffffff, split into 26 bit limbs.
+    st->r[0] = (load32(&key[0])) & 0x3ffffff;
+    st->r[1] = (load32(&key[3]) >> 2) & 0x3ffff03;
+    st->r[2] = (load32(&key[6]) >> 4) & 0x3ffc0ff;
+    st->r[3] = (load32(&key[9]) >> 6) & 0x3f03fff;
+    st->r[4] = (load32(&key[12]) >> 8) & 0x00fffff;
+
+    memset(st->h, 0, sizeof(st->h));
+
+    for (int i = 0; i < 4; i++)
+        st->pad[i] = load32(&key[16 + 4 * i]);
+
+    st->buf_len = 0;
+}
+
+static IRAM_ATTR void poly1305_blocks(poly1305_t* st, const uint8_t* m, size_t len, 
+        uint32_t hibit)
+{
+    const uint32_t r0 = st->r[0], r1 = st->r[1], r2 = st->r[2], r3 = st->r[3], r4 = st->r[4];
+    const uint32_t s1 = r1 * 5, s2 = r2 * 5, s3 = r3 * 5, s4 = r4 * 5;
+    uint32_t h0 = st->h[0], h1 = st->h[1], h2 = st->h[2], h3 = st->h[3], h4 = st->h[4];
+    uint64_t d0, d1, d2, d3, d4;
+    uint32_t c;
+
+    while (len >= POLY_BLOCK_SIZE)
+    {
+        h0 += (load32(&m[0])) & 0x3ffffff;
+        h1 += (load32(&m[3]) >> 2) & 0x3ffffff;
+        h2 += (load32(&m[6]) >> 4) & 0x3ffffff;
+        h3 += (load32(&m[9]) >> 6) & 0x3ffffff;
+        h4 += (load32(&m[12]) >> 8) | hibit;
+
+        d0 = ((uint64_t)h0 * r0) + ((uint64_t)h1 * s4) + ((uint64_t)h2 * s3) + ((uint64_t)h3 * s2) + ((uint64_t)h4 * s1);
+        d1 = ((uint64_t)h0 * r1) + ((uint64_t)h1 * r0) + ((uint64_t)h2 * s4) + ((uint64_t)h3 * s3) + ((uint64_t)h4 * s2);
+        d2 = ((uint64_t)h0 * r2) + ((uint64_t)h1 * r1) + ((uint64_t)h2 * r0) + ((uint64_t)h3 * s4) + ((uint64_t)h4 * s3);
+        d3 = ((uint64_t)h0 * r3) + ((uint64_t)h1 * r2) + ((uint64_t)h2 * r1) + ((uint64_t)h3 * r0) + ((uint64_t)h4 * s4);
+        d4 = ((uint64_t)h0 * r4) + ((uint64_t)h1 * r3) + ((uint64_t)h2 * r2) + ((uint64_t)h3 * r1) + ((uint64_t)h4 * r0);
+
+        c = (uint32_t)(d0 >> 26); h0 = (uint32_t)d0 & 0x3ffffff;
+        d1 += c; c = (uint32_t)(d1 >> 26); h1 = (uint32_t)d1 & 0x3ffffff;
+        d2 += c; c = (uint32_t)(d2 >> 26); h2 = (uint32_t)d2 & 0x3ffffff;
+        d3 += c; c = (uint32_t)(d3 >> 26); h3 = (uint32_t)d3 & 0x3ffffff;
+        d4 += c; c = (uint32_t)(d4 >> 26); h4 = (uint32_t)d4 & 0x3ffffff;
+        h0 += c * 5; c = h0 >> 26; h0 &= 0x3ffffff;
+        h1 += c;
+
+        m += POLY_BLOCK_SIZE;
+        len -= POLY_BLOCK_SIZE;
+    }
+
+    st->h[0] = h0; st->h[1] = h1; st->h[2] = h2; st->h[3] = h3; st->h[4] = h4;
+}
+
+static void poly1305_update(poly1305_t* st, const uint8_t* m, size_t len)
+{
+    if (st->buf_len)
+    {
+        size_t n = POLY_BLOCK_SIZE - st->buf_len;
+        if (n > len)
+            n = len;
+        memcpy(&st->buf[st->buf_len], m, n);
+        st->buf_len += n;
+        m += n;
+        len -= n;
+
+        if (st->buf_len < POLY_BLOCK_SIZE)
+            return;
+
+        poly1305_blocks(st, st->buf, POLY_BLOCK_SIZE, 1 << 24);
+        st->buf_len = 0;
+    }
+
+    size_t full = len & ~(size_t)(POLY_BLOCK_SIZE - 1);
+    if (full)
+    {
+        poly1305_blocks(st, m, full, 1 << 24);
+        m += full;
+        len -= full;
+    }
+
+    if (len)
+    {
+        memcpy(st->buf, m, len);
+        st->buf_len = len;
+    }
+}
+
+/* AEAD pads AD and cipher text to 16 bytes, pending bytes count as a block. */
+static void poly1305_pad16(poly1305_t* st)
+{
+    if (st->buf_len)
+    {
+        memset(&st->buf[st->buf_len], 0, POLY_BLOCK_SIZE - st->buf_len);
+        poly1305_blocks(st, st->buf, POLY_BLOCK_SIZE, 1 << 24);
+        st->buf_len = 0;
+    }
+}
+
+static void poly1305_finish(poly1305_t* st, uint8_t mac[RFC_8439_TAG_SIZE])
+{
+    uint32_t h0, h1, h2, h3, h4, c;
+    uint32_t g0, g1, g2, g3, g4;
+    uint64_t f;
+    uint32_t mask;
+
+    h0 = st->h[0]; h1 = st->h[1]; h2 = st->h[2]; h3 = st->h[3]; h4 = st->h[4];
+
+    c = h1 >> 26; h1 &= 0x3ffffff;
+    h2 += c; c = h2 >> 26; h2 &= 0x3ffffff;
+    h3 += c; c = h3 >> 26; h3 &= 0x3ffffff;
+    h4 += c; c = h4 >> 26; h4 &= 0x3ffffff;
+    h0 += c * 5; c = h0 >> 26; h0 &= 0x3ffffff;
+    h1 += c;
+
+    // h + -p
+    g0 = h0 + 5; c = g0 >> 26; g0 &= 0x3ffffff;
+    g1 = h1 + c; c = g1 >> 26; g1 &= 0x3ffffff;
+    g2 = h2 + c; c = g2 >> 26; g2 &= 0x3ffffff;
+    g3 = h3 + c; c = g3 >> 26; g3 &= 0x3ffffff;
+    g4 = h4 + c - (1 << 26);
+
+    // select h if h < p, or h + -p if h >= p, in constant time.
+    mask = (g4 >> 31) - 1;
+    g0 &= mask; g1 &= mask; g2 &= mask; g3 &= mask; g4 &= mask;
+    mask = ~mask;
+    h0 = (h0 & mask) | g0;
+    h1 = (h1 & mask) | g1;
+    h2 = (h2 & mask) | g2;
+    h3 = (h3 & mask) | g3;
+    h4 = (h4 & mask) | g4;
+
+    // h = h % 2^128
+    h0 = ((h0) | (h1 << 26)) & 0xffffffff;
+    h1 = ((h1 >> 6) | (h2 << 20)) & 0xffffffff;
+    h2 = ((h2 >> 12) | (h3 << 14)) & 0xffffffff;
+    h3 = ((h3 >> 18) | (h4 << 8)) & 0xffffffff;
+
+    // mac = (h + pad) % 2^128
+    f = (uint64_t)h0 + st->pad[0];             h0 = (uint32_t)f;
+    f = (uint64_t)h1 + st->pad[1] + (f >> 32); h1 = (uint32_t)f;
+    f = (uint64_t)h2 + st->pad[2] + (f >> 32); h2 = (uint32_t)f;
+    f = (uint64_t)h3 + st->pad[3] + (f >> 32); h3 = (uint32_t)f;
+
+    store32(&mac[0], h0);
+    store32(&mac[4], h1);
+    store32(&mac[8], h2);
+    store32(&mac[12], h3);
+}
+
+static void aead_tag(uint8_t tag[RFC_8439_TAG_SIZE],
+        const uint8_t key[RFC_8439_KEY_SIZE],
+        const uint8_t nonce[RFC_8439_NONCE_SIZE],
+        const uint8_t* ad, size_t ad_size,
+        const uint8_t* cipher_text, size_t cipher_text_size)
+{
+    uint32_t state[16];
+    uint32_t otk[16];
+    uint8_t lens[16];
+    poly1305_t poly;
+
+    // One time Poly1305 key is first half of block 0.
+    chacha20_init(state, key, 0, nonce);
+    chacha20_block(state, otk);
+    poly1305_init(&poly, (const uint8_t*) otk);
+
+    poly1305_update(&poly, ad, ad_size);
+    poly1305_pad16(&poly);
+    poly1305_update(&poly, cipher_text, cipher_text_size);
+    poly1305_pad16(&poly);
+
+    store32(&lens[0], (uint32_t) ad_size);
+    store32(&lens[4], 0);
+    store32(&lens[8], (uint32_t) cipher_text_size);
+    store32(&lens[12], 0);
+    poly1305_update(&poly, lens, sizeof(lens));
+
+    poly1305_finish(&poly, tag);
+
+    memset(otk, 0, sizeof(otk));
+    memset(&poly, 0, sizeof(poly));
+}
+
+size_t portable_chacha20_poly1305_encrypt(
+    uint8_t* cipher_text,
+    const uint8_t key[RFC_8439_KEY_SIZE],
+    const uint8_t nonce[RFC_8439_NONCE_SIZE],
+    const uint8_t* ad, size_t ad_size,
+    const uint8_t* plain_text, size_t plain_text_size)
+{
+    chacha20_xor(cipher_text, plain_text, plain_text_size, key, 1, nonce);
+    aead_tag(&cipher_text[plain_text_size], key, nonce, ad, ad_size, 
+        cipher_text, plain_text_size);
+
+    return plain_text_size + RFC_8439_TAG_SIZE;
+}
+
+size_t portable_chacha20_poly1305_decrypt(
+    uint8_t* plain_text,
+    const uint8_t key[RFC_8439_KEY_SIZE],
+    const uint8_t nonce[RFC_8439_NONCE_SIZE],
+    const uint8_t* ad, size_t ad_size,
+    const uint8_t* cipher_text, size_t cipher_text_size)
+{
+    uint8_t tag[RFC_8439_TAG_SIZE];
+    uint8_t diff = 0;
+    size_t n;
+
+    if (cipher_text_size < RFC_8439_TAG_SIZE)
+        return RFC_8439_FAIL;
+
+    n = cipher_text_size - RFC_8439_TAG_SIZE;
+
+    aead_tag(tag, key, nonce, ad, ad_size, cipher_text, n);
+
+    // constant time compare.
+    for (int i = 0; i < RFC_8439_TAG_SIZE; i++)
+        diff |= tag[i] ^ cipher_text[n + i];
+
+    if (diff)
+        return RFC_8439_FAIL;
+
+    chacha20_xor(plain_text, cipher_text, n, key, 1, nonce);
+
+    return n;
+}
+
+static const char rfc_plain[] =
+    "Ladies and Gentlemen of the class of '99: If I could offer you only "
+    "one tip for the future, sunscreen would be it.";
+
+static const uint8_t rfc_key[RFC_8439_KEY_SIZE] = {
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f,
+    0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97,
+    0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f
+};
+
+static const uint8_t rfc_nonce[RFC_8439_NONCE_SIZE] = {
+    0x07, 0x00, 0x00, 0x00, 0x40, 0x41, 0x42, 0x43,
+    0x44, 0x45, 0x46, 0x47
+};
+
+static const uint8_t rfc_ad[] = {
+    0x50, 0x51, 0x52, 0x53, 0xc0, 0xc1, 0xc2, 0xc3,
+    0xc4, 0xc5, 0xc6, 0xc7
+};
+
+/* Cipher text head and tag from RFC 8439 section 2.8.2. */
+static const uint8_t rfc_cipher_head[16] = {
+    0xd3, 0x1a, 0x8d, 0x34, 0x64, 0x8e, 0x60, 0xdb,
+    0x7b, 0x86, 0xaf, 0xbc, 0x53, 0xef, 0x7e, 0xc2
+};
+
+static const uint8_t rfc_tag[RFC_8439_TAG_SIZE] = {
+    0x1a, 0xe1, 0x0b, 0x59, 0x4f, 0x09, 0xe2, 0x6a,
+    0x7e, 0x90, 0x2e, 0xcb, 0xd0, 0x60, 0x06, 0x91
+};
+
+#define BENCH_LEN   1024
+#define BENCH_ITERS 16
+
+int rfc8439_self_test(void)
+{
+    const size_t plain_len = sizeof(rfc_plain) - 1;
+    uint8_t cipher[sizeof(rfc_plain) - 1 + RFC_8439_TAG_SIZE];
+    uint8_t plain[sizeof(rfc_plain) - 1];
+    uint8_t* bench;
+    uint32_t t0, enc_cycles, dec_cycles;
+    size_t n;
+
+    n = portable_chacha20_poly1305_encrypt(cipher, rfc_key, rfc_nonce,
+        rfc_ad, sizeof(rfc_ad), (const uint8_t*) rfc_plain, plain_len);
+
+    if ((n != sizeof(cipher))
+        || memcmp(cipher, rfc_cipher_head, sizeof(rfc_cipher_head))
+        || memcmp(&cipher[plain_len], rfc_tag, sizeof(rfc_tag)))
+    {
+        printf("rfc8439: encrypt vector mismatch.\n");
+        return -1;
+    }
+
+    n = portable_chacha20_poly1305_decrypt(plain, rfc_key, rfc_nonce,
+        rfc_ad, sizeof(rfc_ad), cipher, sizeof(cipher));
+
+    if ((n != plain_len) || memcmp(plain, rfc_plain, plain_len))
+    {
+        printf("rfc8439: decrypt vector mismatch.\n");
+        return -1;
+    }
+
+    cipher[0] ^= 1;
+    n = portable_chacha20_poly1305_decrypt(plain, rfc_key, rfc_nonce,
+        rfc_ad, sizeof(rfc_ad), cipher, sizeof(cipher));
+    if (n != RFC_8439_FAIL)
+    {
+        printf("rfc8439: forged tag accepted.\n");
+        return -1;
+    }
+
+    bench = heap_caps_malloc(2 * BENCH_LEN + RFC_8439_TAG_SIZE, MALLOC_CAP_INTERNAL);
+    if (bench == NULL)
+        return 0;
+
+    memset(bench, 0xa5, BENCH_LEN);
+
+    t0 = dsp_get_cpu_cycle_count();
+    for (int i = 0; i < BENCH_ITERS; i++)
+    {
+        portable_chacha20_poly1305_encrypt(&bench[BENCH_LEN], rfc_key, rfc_nonce,
+            rfc_ad, sizeof(rfc_ad), bench, BENCH_LEN);
+    }
+    enc_cycles = dsp_get_cpu_cycle_count() - t0;
+
+    t0 = dsp_get_cpu_cycle_count();
+    for (int i = 0; i < BENCH_ITERS; i++)
+    {
+        portable_chacha20_poly1305_decrypt(bench, rfc_key, rfc_nonce,
+            rfc_ad, sizeof(rfc_ad), &bench[BENCH_LEN], BENCH_LEN + RFC_8439_TAG_SIZE);
+    }
+    dec_cycles = dsp_get_cpu_cycle_count() - t0;
+
+    heap_caps_free(bench);
+
+    printf("rfc8439: vectors ok, enc %.1f dec %.1f cycles/byte.\n",
+        (float) enc_cycles / (BENCH_LEN * BENCH_ITERS),
+        (float) dec_cycles / (BENCH_LEN * BENCH_ITERS));
+
+    return 0;
+}
@@ -0,0 +1,85 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdatomic.h>
+
+#include "trill.h"
+#include "app_config.h"
+#include "rx_pool.h"
+
+static rx_buf_t rx_pool[APP_RX_POOL_DEPTH];
+static atomic_uint exhausted_count;
+
+static rx_buf_t* rx_pool_get(void)
+{
+    for (int i = 0; i < APP_RX_POOL_DEPTH; i++)
+    {
+        int expected = 0;
+
+        // Claim a free buffer.
+        if (atomic_compare_exchange_strong(&rx_pool[i].refs, &expected, 1))
+        {
+            return &rx_pool[i];
+        }
+    }
+
+    atomic_fetch_add(&exhausted_count, 1);
+
+    return NULL;
+}
+
+rx_buf_t* rx_buf_from_event(const trill_data_link_event_params_t* params)
+{
+    rx_buf_t* buf = rx_pool_get();
+    if (buf == NULL)
+    {
+        return NULL;
+    }
+
+    buf->len = params->payload_len;
+    if (buf->len > sizeof(buf->data))
+    {
+        buf->len = sizeof(buf->data);
+    }
+
+    memcpy(buf->data, params->payload, buf->len);
+    buf->ssi = params->ssi;
+    buf->data_cfg_range = params->data_cfg_range;
+    buf->channel = params->channel;
+    link_quality_on_rx(params, &buf->metrics);
+
+    return buf;
+}
+
+void rx_buf_retain(rx_buf_t* buf)
+{
+    atomic_fetch_add(&buf->refs, 1);
+}
+
+void rx_buf_release(rx_buf_t* buf)
+{
+    int prev = atomic_fetch_sub(&buf->refs, 1);
+    
+    if (prev <= 0)
+    {
+        printf("***rx_buf_release on free buffer***\n");
+        atomic_store(&buf->refs, 0);
+    }
+}
+
+unsigned int rx_pool_in_use(void)
+{
+    unsigned int n = 0;
+
+    for (int i = 0; i < APP_RX_POOL_DEPTH; i++)
+    {
+        if (atomic_load(&rx_pool[i].refs) > 0)
+            n++;
+    }
+
+    return n;
+}
+
+unsigned int rx_pool_exhausted_count(void)
+{
+    return atomic_load(&exhausted_count);
+}
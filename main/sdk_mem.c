@@ -0,0 +1,362 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "esp_heap_caps.h"
+
+#include "app_config.h"
+#include "sdk_mem.h"
+
+#define N_EXPECT        4
+
+enum {
+    REGION_INTERNAL = 0,
+    REGION_PSRAM,
+    N_REGIONS
+};
+
+typedef struct {
+    void* ptr;
+    unsigned int size;
+    unsigned char tag;
+    unsigned char region;
+} block_t;
+
+// Table block of the first instance, by order of table requests in init.
+typedef struct {
+    void* ptr;
+    unsigned int size;
+    unsigned int alignment;
+    unsigned int refs;
+    uint32_t sum;
+    int reused;     // handed out again in current init
+    void* backup;   // first instance content while reused in init
+} shared_t;
+
+static const struct {
+    const char* name;
+    int hot;
+} tags[SDK_MEM_N_TAGS] = {
+    [SDK_MEM_STATE]     = {"state",     1},
+    [SDK_MEM_DSP]       = {"dsp",       1},
+    [SDK_MEM_TABLE]     = {"table",     0},
+    [SDK_MEM_AUDIO_RX]  = {"audio_rx",  APP_SDK_MEM_AUDIO_HOT},
+    [SDK_MEM_AUDIO_TX]  = {"audio_tx",  APP_SDK_MEM_AUDIO_HOT},
+};
+
+static const uint32_t region_caps[N_REGIONS] = {
+    MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT,
+    MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT,
+};
+
+static struct {
+    size_t size;
+    sdk_mem_tag_t tag;
+} expect[N_EXPECT];
+static unsigned int n_expect;
+
+// Few dozen blocks live at a time, a table is enough.
+static block_t blocks[APP_SDK_MEM_MAX_BLOCKS];
+static unsigned int live[SDK_MEM_N_TAGS][N_REGIONS];
+static unsigned int peak[SDK_MEM_N_TAGS][N_REGIONS];
+static unsigned int n_fallbacks;
+static unsigned int n_untracked;
+static unsigned int n_live_blocks;
+static unsigned int total_live;
+static unsigned int total_peak;
+static portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+
+static shared_t shared[APP_SDK_MEM_SHARED_MAX];
+static int share_active;
+static unsigned int share_ordinal;
+static unsigned int shared_saved;
+
+void sdk_mem_expect(sdk_mem_tag_t tag, size_t size)
+{
+    // Size seen before keeps its first tag, also on SDK restart.
+    for (int i = 0; i < n_expect; i++)
+    {
+        if (expect[i].size == size)
+            return;
+    }
+
+    if (n_expect < N_EXPECT)
+    {
+        expect[n_expect].size = size;
+        expect[n_expect].tag = tag;
+        n_expect++;
+    }
+}
+
+static void track(void* ptr, unsigned int size, sdk_mem_tag_t tag, int region)
+{
+    portENTER_CRITICAL(&lock);
+
+    for (int i = 0; i < APP_SDK_MEM_MAX_BLOCKS; i++)
+    {
+        if (blocks[i].ptr == NULL)
+        {
+            blocks[i].ptr = ptr;
+            blocks[i].size = size;
+            blocks[i].tag = tag;
+            blocks[i].region = region;
+
+            live[tag][region] += size;
+            if (live[tag][region] > peak[tag][region])
+                peak[tag][region] = live[tag][region];
+
+            n_live_blocks++;
+            total_live += size;
+            if (total_live > total_peak)
+                total_peak = total_live;
+
+            portEXIT_CRITICAL(&lock);
+            return;
+        }
+    }
+
+    n_untracked++;
+    portEXIT_CRITICAL(&lock);
+}
+
+static void* place(unsigned int alignment, unsigned int size, sdk_mem_tag_t tag)
+{
+    int region = tags[tag].hot ? REGION_INTERNAL : REGION_PSRAM;
+    void* ptr;
+
+    for (int k = 0; k < N_REGIONS; k++)
+    {
+        if (alignment)
+            ptr = heap_caps_aligned_alloc(alignment, size, region_caps[region]);
+        else
+            ptr = heap_caps_malloc(size, region_caps[region]);
+
+        if (ptr)
+        {
+            if (k)
+                n_fallbacks++;
+            track(ptr, size, tag, region);
+            return ptr;
+        }
+
+        // Preferred region is full, better slower than failing init.
+        region = (region == REGION_INTERNAL) ? REGION_PSRAM : REGION_INTERNAL;
+    }
+
+    printf("sdk_mem: %s alloc of %u failed\n", tags[tag].name, size);
+    return NULL;
+}
+
+void* sdk_mem_alloc(unsigned int size)
+{
+    sdk_mem_tag_t tag = SDK_MEM_STATE;
+
+    for (int i = 0; i < n_expect; i++)
+    {
+        if (expect[i].size == size)
+        {
+            tag = expect[i].tag;
+            break;
+        }
+    }
+
+    return place(0, size, tag);
+}
+
+static void* table_alloc(unsigned int alignment, unsigned int size)
+{
+    shared_t* sh;
+    unsigned int k = share_ordinal++;
+
+    if (k >= APP_SDK_MEM_SHARED_MAX)
+        return place(alignment, size, SDK_MEM_TABLE);
+
+    sh = &shared[k];
+
+    if (sh->ptr == NULL)
+    {
+        sh->ptr = place(alignment, size, SDK_MEM_TABLE);
+        sh->size = size;
+        sh->alignment = alignment;
+        sh->refs = sh->ptr ? 1 : 0;
+        sh->sum = 0;
+        sh->reused = 0;
+        return sh->ptr;
+    }
+
+    // Other block layout, tables differ.
+    if ((sh->size != size) || (sh->alignment != alignment))
+        return place(alignment, size, SDK_MEM_TABLE);
+
+    // Later init writes into a live block, keep first content to undo it.
+    sh->backup = heap_caps_malloc(size, region_caps[REGION_PSRAM]);
+    if (sh->backup == NULL)
+        return place(alignment, size, SDK_MEM_TABLE);
+    memcpy(sh->backup, sh->ptr, size);
+
+    sh->refs++;
+    sh->reused = 1;
+    shared_saved += size;
+    return sh->ptr;
+}
+
+void* sdk_mem_aligned_alloc(unsigned int alignment, unsigned int size)
+{
+    // ESP-DSP blocks need 16 byte alignment buffers.
+    if (alignment == 16)
+        return place(alignment, size, SDK_MEM_DSP);
+
+    if (share_active)
+        return table_alloc(alignment, size);
+
+    return place(alignment, size, SDK_MEM_TABLE);
+}
+
+static uint32_t block_sum(const void* ptr, unsigned int size)
+{
+    const uint8_t* p = ptr;
+    uint32_t h = 2166136261u;   // FNV-1a
+
+    for (unsigned int i = 0; i < size; i++)
+    {
+        h = (h ^ p[i]) * 16777619u;
+    }
+
+    return h;
+}
+
+void sdk_mem_share_begin(void)
+{
+    share_ordinal = 0;
+    share_active = 1;
+}
+
+int sdk_mem_share_end(void)
+{
+    int n_bad = 0;
+
+    share_active = 0;
+
+    for (int i = 0; i < APP_SDK_MEM_SHARED_MAX; i++)
+    {
+        shared_t* sh = &shared[i];
+
+        if (sh->ptr == NULL)
+            continue;
+
+        if (sh->refs == 1 && !sh->reused)
+        {
+            sh->sum = block_sum(sh->ptr, sh->size);
+        }
+        else if (sh->reused && (block_sum(sh->ptr, sh->size) != sh->sum))
+        {
+            // Later instance generated different content, not a read-only
+            // table. Give the first instance its content back, caller must
+            // drop the later one.
+            memcpy(sh->ptr, sh->backup, sh->size);
+            n_bad++;
+        }
+
+        if (sh->backup)
+        {
+            free(sh->backup);
+            sh->backup = NULL;
+        }
+        sh->reused = 0;
+    }
+
+    return n_bad;
+}
+
+int sdk_mem_share_verify(void)
+{
+    int n_bad = 0;
+
+    for (int i = 0; i < APP_SDK_MEM_SHARED_MAX; i++)
+    {
+        if (shared[i].ptr && (block_sum(shared[i].ptr, shared[i].size) != shared[i].sum))
+            n_bad++;
+    }
+
+    return n_bad;
+}
+
+unsigned int sdk_mem_shared_saved(void)
+{
+    return shared_saved;
+}
+
+void sdk_mem_free(void* ptr)
+{
+    int tracked = 0;
+
+    if (ptr == NULL)
+    {
+        printf("***Trying to free NULL pointer***\n");
+        return;
+    }
+
+    for (int i = 0; i < APP_SDK_MEM_SHARED_MAX; i++)
+    {
+        if (shared[i].ptr == ptr)
+        {
+            if (--shared[i].refs > 0)
+            {
+                shared_saved -= shared[i].size;
+                return;
+            }
+            shared[i].ptr = NULL;
+            break;
+        }
+    }
+
+    portENTER_CRITICAL(&lock);
+    for (int i = 0; i < APP_SDK_MEM_MAX_BLOCKS; i++)
+    {
+        if (blocks[i].ptr == ptr)
+        {
+            live[blocks[i].tag][blocks[i].region] -= blocks[i].size;
+            n_live_blocks--;
+            total_live -= blocks[i].size;
+            blocks[i].ptr = NULL;
+            tracked = 1;
+            break;
+        }
+    }
+    // Allocated while the table was full.
+    if (!tracked && n_untracked)
+        n_untracked--;
+    portEXIT_CRITICAL(&lock);
+
+    free(ptr);
+}
+
+unsigned int sdk_mem_outstanding(unsigned int* n_blocks)
+{
+    if (n_blocks)
+        *n_blocks = n_live_blocks + n_untracked;
+
+    return total_live;
+}
+
+unsigned int sdk_mem_peak(void)
+{
+    return total_peak;
+}
+
+void sdk_mem_report(void)
+{
+    printf("sdk mem: %-10s %10s %10s %10s %10s\n",
+        "tag", "internal", "psram", "peak int", "peak psram");
+
+    for (int t = 0; t < SDK_MEM_N_TAGS; t++)
+    {
+        printf("sdk mem: %-10s %10u %10u %10u %10u\n", tags[t].name,
+            live[t][REGION_INTERNAL], live[t][REGION_PSRAM],
+            peak[t][REGION_INTERNAL], peak[t][REGION_PSRAM]);
+    }
+
+    printf("sdk mem: fallbacks %u, untracked blocks %u, shared tables saved %u\n",
+        n_fallbacks, n_untracked, shared_saved);
+}
@@ -2,6 +2,8 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
 #include "esp_system.h"
 #include "esp_log.h"
 #include "esp_console.h"
@@ -16,10 +18,21 @@
 
 
 static const char* TAG = "serial_com";
+#define LIC_BACKUP_PATH     TRILLBIT_LICENSE_PATH ".bak"
+
 static char lic_buffer[TRILL_MAX_LICENSE_STRING_SIZE+1];
+// Handed to the app, parts of a next upload go to lic_buffer.
+static char lic_apply[TRILL_MAX_LICENSE_STRING_SIZE+1];
+static esp_console_repl_t* repl_handle;
+static lic_set_cb_t volatile lic_set_cb;
+static SemaphoreHandle_t lic_done;
+static volatile int lic_pending;
+static volatile int lic_result;
+static int lic_backup;
 
 static int rx_error(serial_command_errors_t code);
 static int save_license_buf(void);
+static int apply_license(lic_set_cb_t cb);
 
 static int calc_check_sum_buf(const char* buf, int len)
 {
@@ -116,6 +129,7 @@ static int ser_cmd_handler(int argc, char **argv)
 			}
 			else
 			{
+				lic_set_cb_t cb = lic_set_cb;
 				int given_sum = atoi(argv[2]);
 				int sum = calc_check_sum_buf(lic_buffer, strlen(lic_buffer));
 				if (sum != given_sum)
@@ -123,15 +137,29 @@ static int ser_cmd_handler(int argc, char **argv)
 					return rx_error(SER_CMD_ERROR_CODE_CHECKSUM_MISMATCH);
 				}
 
-				rx_error(0);
+				if (lic_pending)
+				{
+					// Previous license is still being applied.
+					return rx_error(SER_CMD_ERROR_CODE_OS_ERROR);
+				}
 
 				// save license 
 				ret = save_license_buf();
-				if (!ret)
+				if (ret < 0)
+				{
+					return rx_error(SER_CMD_ERROR_CODE_OS_ERROR);
+				}
+
+				if (cb)
 				{
-					// reboot.
-					esp_restart();
+					// App applies the license without a reboot, reply
+					// once it was accepted or rejected.
+					return rx_error(apply_license(cb));
 				}
+
+				rx_error(0);
+				// reboot.
+				esp_restart();
 			}
 			break;
 		default:
@@ -142,7 +170,7 @@ static int ser_cmd_handler(int argc, char **argv)
 	return 0;
 }
 
-int ser_cmd_init(void)
+int ser_cmd_init(lic_set_cb_t cb)
 {
     esp_console_repl_t *repl = NULL;
     esp_console_repl_config_t repl_config = ESP_CONSOLE_REPL_CONFIG_DEFAULT();
@@ -153,6 +181,21 @@ int ser_cmd_init(void)
     repl_config.prompt = CONFIG_IDF_TARGET ">";
     repl_config.max_cmdline_length = 512;
 
+    if (lic_done == NULL)
+    {
+        lic_done = xSemaphoreCreateBinary();
+        if (lic_done == NULL)
+            return -1;
+    }
+
+    lic_set_cb = cb;
+
+    // REPL is kept running after ser_cmd_deinit.
+    if (repl_handle)
+    {
+        return 0;
+    }
+
     esp_console_register_help_command();
 
     const esp_console_cmd_t trill_cmd = {
@@ -171,11 +214,68 @@ int ser_cmd_init(void)
 
     ESP_ERROR_CHECK(esp_console_start_repl(repl));
 
-	
+    repl_handle = repl;
 
     return 0;
 }
 
+int ser_cmd_deinit(void)
+{
+    /*
+        IDF v4.4 REPL delete frees the REPL while its task is still
+        blocked in linenoise. Keep it running, a license set from now
+        on is saved and applied with a reboot.
+    */
+    lic_set_cb = NULL;
+
+    return 0;
+}
+
+void ser_cmd_lic_result(int result)
+{
+    if (!lic_pending)
+        return;
+
+    if (result < 0)
+    {
+        // Rejected, do not keep it for next boot.
+        remove(TRILLBIT_LICENSE_PATH);
+        if (lic_backup && (rename(LIC_BACKUP_PATH, TRILLBIT_LICENSE_PATH) != 0))
+            printf("Failed to restore previous License file.\n");
+    }
+    else if (lic_backup)
+    {
+        remove(LIC_BACKUP_PATH);
+    }
+
+    lic_backup = 0;
+    lic_result = result;
+    lic_pending = 0;
+    xSemaphoreGive(lic_done);
+}
+
+/* REPL task. Returns reply code for SER_CMD_LIC_SET. */
+static int apply_license(lic_set_cb_t cb)
+{
+    strcpy(lic_apply, lic_buffer);
+
+    xSemaphoreTake(lic_done, 0);
+    lic_pending = 1;
+
+    if (cb(lic_apply) < 0)
+    {
+        ser_cmd_lic_result(-1);
+    }
+
+    if (xSemaphoreTake(lic_done, pdMS_TO_TICKS(SER_CMD_LIC_APPLY_TIMEOUT)) != pdTRUE)
+    {
+        // Still applying, outcome is on the console later.
+        return SER_CMD_ERROR_CODE_OS_ERROR;
+    }
+
+    return (lic_result < 0) ? SER_CMD_ERROR_CODE_APPLY_KEYS_FAILED : 0;
+}
+
 static int rx_error(serial_command_errors_t code)
 {
 	printf("%s %d\n", SER_CMD_RESP_PREFIX, code);
@@ -185,7 +285,17 @@ static int rx_error(serial_command_errors_t code)
 
 static int save_license_buf(void)
 {
-	FILE* fp = fopen(TRILLBIT_LICENSE_PATH, "w");
+	FILE* fp;
+
+	// Kept until the app accepted the new one.
+	lic_backup = 0;
+	if (lic_set_cb)
+	{
+		remove(LIC_BACKUP_PATH);
+		lic_backup = (rename(TRILLBIT_LICENSE_PATH, LIC_BACKUP_PATH) == 0);
+	}
+
+	fp = fopen(TRILLBIT_LICENSE_PATH, "w");
     if (fp == NULL)
     {
         printf("Failed to create License file.\n");
@@ -199,6 +309,7 @@ static int save_license_buf(void)
 	if (nitems != 1)
 	{
 		printf("Failed to write License file.\n");
+		fclose(fp);
         return -1;
 	}
 
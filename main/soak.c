@@ -0,0 +1,205 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+#include "esp_heap_caps.h"
+
+#include "trill.h"
+#include "trill_error.h"
+#include "app_config.h"
+#include "sdk_mem.h"
+#include "soak.h"
+
+#define TONE_HZ             18000.0f
+#define SAMPLE_RATE_HZ      48000.0f
+#define SOAK_MSG            "soak test message"
+
+enum {
+    REGION_INTERNAL = 0,
+    REGION_PSRAM,
+    REGION_DMA,
+    N_REGIONS
+};
+
+static const struct {
+    const char* name;
+    uint32_t caps;
+} regions[N_REGIONS] = {
+    [REGION_INTERNAL]   = {"internal", MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT},
+    [REGION_PSRAM]      = {"psram", MALLOC_CAP_SPIRAM},
+    [REGION_DMA]        = {"dma", MALLOC_CAP_DMA},
+};
+
+typedef struct {
+    unsigned int free;
+    unsigned int largest;
+} heap_sample_t;
+
+static void heap_sample(heap_sample_t s[N_REGIONS])
+{
+    for (int r = 0; r < N_REGIONS; r++)
+    {
+        s[r].free = heap_caps_get_free_size(regions[r].caps);
+        s[r].largest = heap_caps_get_largest_free_block(regions[r].caps);
+    }
+}
+
+// Tone over noise, new noise every block so CTS search does real work.
+static void synth_block(int16_t* block, unsigned int n_samples, 
+        unsigned int n_channels, unsigned int* phase, uint32_t* seed)
+{
+    for (unsigned int n = 0; n < n_samples; n++, (*phase)++)
+    {
+        float tone = 4000.0f * sinf(2.0f * (float) M_PI * TONE_HZ * *phase / SAMPLE_RATE_HZ);
+
+        for (unsigned int c = 0; c < n_channels; c++)
+        {
+            *seed = *seed * 1664525u + 1013904223u;
+            block[n * n_channels + c] = (int16_t) (tone + (int16_t) (*seed >> 16) / 16);
+        }
+    }
+}
+
+static int soak_cycle(const soak_ops_t* ops, int16_t* block, uint32_t* seed)
+{
+    void* handle = NULL;
+    trill_tx_params_t tx_params = {
+        .ssi = SSI_PLAIN_TEXT,
+        .ck_nonce = NULL,
+        .data_cfg_range = TRILL_DATA_CFG_RANGE_FAR,
+    };
+    unsigned int phase = 0;
+    short* tx_block;
+    int ret;
+
+    ret = ops->init(&handle);
+    if (ret < 0)
+    {
+        return ret;
+    }
+
+    for (int i = 0; i < APP_SOAK_RX_BLOCKS; i++)
+    {
+        synth_block(block, ops->n_samples, ops->n_channels, &phase, seed);
+        trill_add_audio_block(handle, block);
+        trill_process(handle);
+    }
+
+    ret = trill_tx_data(handle, &tx_params, (unsigned char*) SOAK_MSG, strlen(SOAK_MSG));
+    if (ret < 0)
+    {
+        printf("soak: trill_tx_data = %d\n", ret);
+    }
+
+    // Modulate part of the packet, then abort it.
+    for (int i = 0; i < APP_SOAK_TX_BLOCKS; i++)
+    {
+        trill_process(handle);
+        if (trill_acquire_audio_block(handle, &tx_block, 0) >= 0)
+        {
+            trill_release_audio_block(handle);
+        }
+    }
+
+    trill_tx_abort(handle);
+    trill_process(handle);
+
+    ops->deinit(handle);
+
+    return 0;
+}
+
+static void report(unsigned int cycle, const heap_sample_t s[N_REGIONS])
+{
+    unsigned int n_blocks;
+    unsigned int bytes = sdk_mem_outstanding(&n_blocks);
+
+    printf("soak %u: sdk outstanding %u bytes in %u blocks, sdk peak %u", 
+        cycle, bytes, n_blocks, sdk_mem_peak());
+
+    for (int r = 0; r < N_REGIONS; r++)
+    {
+        printf(" | %s free %u largest %u", regions[r].name, s[r].free, s[r].largest);
+    }
+    printf("\n");
+}
+
+int soak_run(const soak_ops_t* ops, unsigned int n_cycles)
+{
+    heap_sample_t base[N_REGIONS], s[N_REGIONS];
+    uint32_t seed = 1;
+    unsigned int n_blocks;
+    int16_t* block;
+    int ret = 0;
+
+    block = heap_caps_malloc(ops->n_samples * ops->n_channels * sizeof(int16_t), 
+                MALLOC_CAP_SPIRAM);
+    if (block == NULL)
+    {
+        return -1;
+    }
+
+    printf("soak: %u cycles\n", n_cycles);
+
+    for (unsigned int cycle = 1; cycle <= n_cycles; cycle++)
+    {
+        ret = soak_cycle(ops, block, &seed);
+        if (ret < 0)
+        {
+            printf("soak FAIL at cycle %u: init = %d\n", cycle, ret);
+            break;
+        }
+
+        heap_sample(s);
+
+        if (sdk_mem_outstanding(&n_blocks) || n_blocks)
+        {
+            report(cycle, s);
+            printf("soak FAIL at cycle %u: SDK leaked allocations\n", cycle);
+            ret = -1;
+            break;
+        }
+
+        // First cycles may set up lazily allocated platform state.
+        if (cycle <= APP_SOAK_WARMUP_CYCLES)
+        {
+            memcpy(base, s, sizeof(base));
+            report(cycle, s);
+            continue;
+        }
+
+        if ((cycle % APP_SOAK_REPORT_CYCLES) == 0)
+        {
+            report(cycle, s);
+        }
+
+        for (int r = 0; r < N_REGIONS; r++)
+        {
+            if ((s[r].free + APP_SOAK_HEAP_SLACK < base[r].free) || 
+                (s[r].largest + APP_SOAK_HEAP_SLACK < base[r].largest))
+            {
+                report(cycle, s);
+                printf("soak FAIL at cycle %u: %s free %u (was %u), largest %u (was %u)\n",
+                    cycle, regions[r].name, s[r].free, base[r].free, 
+                    s[r].largest, base[r].largest);
+                ret = -1;
+            }
+        }
+
+        if (ret < 0)
+        {
+            break;
+        }
+    }
+
+    if (ret == 0)
+    {
+        printf("soak PASS: %u cycles\n", n_cycles);
+    }
+
+    heap_caps_free(block);
+
+    return ret;
+}
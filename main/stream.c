@@ -0,0 +1,339 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_rom_crc.h"
+
+#include "trill.h"
+#include "app_config.h"
+#include "tx_queue.h"
+#include "stream.h"
+
+#define STREAM_TYPE_SEG     0xF4
+#define STREAM_ID_MASK      0x7F
+#define STREAM_LAST         0x80
+
+typedef enum {
+    STREAM_TX_IDLE = 0,
+    STREAM_TX_OPEN,
+    STREAM_TX_CLOSING
+} stream_tx_state_t;
+
+static SemaphoreHandle_t lock;
+static stream_rx_cb_t rx_cb;
+static uint8_t next_id;
+
+static struct {
+    stream_tx_state_t state;
+    trill_tx_params_t params;
+    uint8_t id;
+    uint16_t seq;
+    uint32_t crc;
+    unsigned int head;          // oldest byte
+    unsigned int count;
+    TickType_t oldest;          // when oldest byte was written
+    unsigned int n_written;
+    unsigned int n_dropped;     // refused, ring full
+    unsigned int n_segs;
+    unsigned int n_seg_bytes;
+    uint8_t ring[APP_STREAM_RING_LEN];
+} tx;
+
+static struct {
+    int active;
+    uint8_t id;
+    uint16_t next_seq;
+    uint32_t crc;
+    unsigned int offset;
+    TickType_t last_rx;
+    unsigned int n_segs;
+    unsigned int n_lost;
+    unsigned int n_crc_bad;
+} rx;
+
+int stream_init(stream_rx_cb_t rx_callback)
+{
+    if (lock == NULL)
+    {
+        lock = xSemaphoreCreateMutex();
+        if (lock == NULL)
+            return -1;
+    }
+
+    rx_cb = rx_callback;
+    stream_reset();
+
+    return 0;
+}
+
+void stream_reset(void)
+{
+    xSemaphoreTake(lock, portMAX_DELAY);
+    tx.state = STREAM_TX_IDLE;
+    tx.count = 0;
+    rx.active = 0;
+    xSemaphoreGive(lock);
+}
+
+int stream_open(const trill_tx_params_t* params)
+{
+    int ret = 0;
+
+    if ((lock == NULL) || (params == NULL))
+        return -1;
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+
+    if (tx.state != STREAM_TX_IDLE)
+    {
+        ret = -1;
+    }
+    else
+    {
+        tx.params = *params;
+        tx.id = next_id++ & STREAM_ID_MASK;
+        tx.seq = 0;
+        tx.crc = 0;
+        tx.head = 0;
+        tx.count = 0;
+        tx.n_written = 0;
+        tx.n_dropped = 0;
+        tx.n_segs = 0;
+        tx.n_seg_bytes = 0;
+        tx.state = STREAM_TX_OPEN;
+    }
+
+    xSemaphoreGive(lock);
+    return ret;
+}
+
+int stream_write(const uint8_t* data, unsigned int len)
+{
+    unsigned int n, tail, first;
+
+    if (lock == NULL)
+        return -1;
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+
+    if (tx.state != STREAM_TX_OPEN)
+    {
+        xSemaphoreGive(lock);
+        return -1;
+    }
+
+    n = APP_STREAM_RING_LEN - tx.count;
+    if (n > len)
+        n = len;
+
+    if (n)
+    {
+        if (tx.count == 0)
+            tx.oldest = xTaskGetTickCount();
+
+        tail = (tx.head + tx.count) % APP_STREAM_RING_LEN;
+        first = APP_STREAM_RING_LEN - tail;
+        if (first > n)
+            first = n;
+
+        memcpy(&tx.ring[tail], data, first);
+        memcpy(&tx.ring[0], data + first, n - first);
+        tx.count += n;
+        tx.n_written += n;
+    }
+    tx.n_dropped += len - n;
+
+    xSemaphoreGive(lock);
+    return n;
+}
+
+int stream_close(void)
+{
+    int ret = 0;
+
+    if (lock == NULL)
+        return -1;
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    if (tx.state == STREAM_TX_OPEN)
+        tx.state = STREAM_TX_CLOSING;
+    else
+        ret = -1;
+    xSemaphoreGive(lock);
+
+    return ret;
+}
+
+int stream_tx_busy(void)
+{
+    return tx.state != STREAM_TX_IDLE;
+}
+
+/* Queue one segment of up to len ring bytes. Ring is consumed only when queued. */
+static int send_segment(unsigned int len, int last)
+{
+    uint8_t pkt[TRILL_MAX_DATA_PAYLOAD_LEN];
+    unsigned int first = APP_STREAM_RING_LEN - tx.head;
+    uint32_t crc;
+
+    if (first > len)
+        first = len;
+
+    memcpy(&pkt[STREAM_HDR_LEN], &tx.ring[tx.head], first);
+    memcpy(&pkt[STREAM_HDR_LEN + first], &tx.ring[0], len - first);
+
+    crc = esp_rom_crc32_le(tx.crc, &pkt[STREAM_HDR_LEN], len);
+
+    pkt[0] = STREAM_TYPE_SEG;
+    pkt[1] = tx.id | (last ? STREAM_LAST : 0);
+    pkt[2] = tx.seq & 0xFF;
+    pkt[3] = tx.seq >> 8;
+    pkt[4] = crc & 0xFF;
+    pkt[5] = (crc >> 8) & 0xFF;
+    pkt[6] = (crc >> 16) & 0xFF;
+    pkt[7] = crc >> 24;
+
+    if (tx_queue_send(&tx.params, pkt, STREAM_HDR_LEN + len, NULL) < 0)
+        return -1;
+
+    tx.crc = crc;
+    tx.seq++;
+    tx.head = (tx.head + len) % APP_STREAM_RING_LEN;
+    tx.count -= len;
+    tx.n_segs++;
+    tx.n_seg_bytes += len;
+
+    return 0;
+}
+
+static void poll_tx(TickType_t now)
+{
+    unsigned int n;
+    int last;
+
+    while (tx.state != STREAM_TX_IDLE)
+    {
+        n = (tx.count > STREAM_SEG_DATA_LEN) ? STREAM_SEG_DATA_LEN : tx.count;
+        last = (tx.state == STREAM_TX_CLOSING) && (n == tx.count);
+
+        // Hold a partial segment back, more writes may fill it.
+        if ((n < STREAM_SEG_DATA_LEN) && !last)
+        {
+            if ((n == 0) || ((int32_t)(now - tx.oldest) < pdMS_TO_TICKS(APP_STREAM_FLUSH_MS)))
+                return;
+        }
+
+        // Queue full, rest goes with the next poll.
+        if (!tx_queue_space() || (send_segment(n, last) < 0))
+            return;
+
+        // Remaining bytes were written later than the segment sent.
+        tx.oldest = now;
+
+        if (last)
+        {
+            tx.state = STREAM_TX_IDLE;
+            stream_print_stats();
+        }
+    }
+}
+
+int stream_on_rx(const uint8_t* pkt, unsigned int len)
+{
+    stream_chunk_t chunk;
+    uint16_t seq, lost;
+    uint32_t crc, run;
+    uint8_t id;
+
+    if ((len < STREAM_HDR_LEN) || (pkt[0] != STREAM_TYPE_SEG))
+        return 0;
+
+    if (lock == NULL)
+        return 1;
+
+    id = pkt[1] & STREAM_ID_MASK;
+    seq = pkt[2] | (pkt[3] << 8);
+    crc = pkt[4] | (pkt[5] << 8) | (pkt[6] << 16) | ((uint32_t) pkt[7] << 24);
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+
+    if (!rx.active || (rx.id != id))
+    {
+        rx.active = 1;
+        rx.id = id;
+        rx.next_seq = 0;
+        rx.crc = 0;
+        rx.offset = 0;
+    }
+
+    lost = seq - rx.next_seq;
+    // Seq behind the expected one, a repeated segment.
+    if (lost & 0x8000)
+    {
+        xSemaphoreGive(lock);
+        return 1;
+    }
+
+    chunk.id = id;
+    chunk.data = &pkt[STREAM_HDR_LEN];
+    chunk.len = len - STREAM_HDR_LEN;
+    chunk.offset = rx.offset;
+    chunk.lost = lost;
+    chunk.last = (pkt[1] & STREAM_LAST) ? 1 : 0;
+
+    run = esp_rom_crc32_le(rx.crc, chunk.data, chunk.len);
+    chunk.crc_ok = (lost == 0) && (run == crc);
+    if ((lost == 0) && (run != crc))
+        rx.n_crc_bad++;
+
+    // After a gap continue from sender's CRC, later segments check again.
+    rx.crc = crc;
+    rx.next_seq = seq + 1;
+    rx.offset += chunk.len;
+    rx.last_rx = xTaskGetTickCount();
+    rx.n_segs++;
+    rx.n_lost += lost;
+
+    if (rx_cb)
+        rx_cb(&chunk);
+
+    if (chunk.last)
+        rx.active = 0;
+
+    xSemaphoreGive(lock);
+    return 1;
+}
+
+static void poll_rx(TickType_t now)
+{
+    // Sender gone without last segment, next one starts a new stream.
+    if (rx.active && ((int32_t)(now - rx.last_rx) >= pdMS_TO_TICKS(APP_STREAM_RX_IDLE_MS)))
+    {
+        printf("stream: rx %u idle, closed at %u bytes\n", rx.id, rx.offset);
+        rx.active = 0;
+    }
+}
+
+void stream_poll(void)
+{
+    TickType_t now = xTaskGetTickCount();
+
+    if (lock == NULL)
+        return;
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    poll_tx(now);
+    poll_rx(now);
+    xSemaphoreGive(lock);
+}
+
+void stream_print_stats(void)
+{
+    printf("stream: tx %u written, %u refused, %u segments, avg %u bytes/segment\n",
+        tx.n_written, tx.n_dropped, tx.n_segs,
+        tx.n_segs ? tx.n_seg_bytes / tx.n_segs : 0);
+    printf("stream: rx %u segments, %u lost, %u crc mismatch\n",
+        rx.n_segs, rx.n_lost, rx.n_crc_bad);
+}
@@ -0,0 +1,133 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_heap_caps.h"
+
+#include "trace.h"
+
+#define TRACE_VERSION       1
+#define EVENTS_PER_LINE     16
+
+#define PH_MASK             0x03
+#define CORE_SHIFT          2
+
+// Little endian on the wire, 48 bit timestamp is ~8.9 years of us.
+typedef struct __attribute__((packed)) {
+    uint32_t ts_lo;
+    uint16_t ts_hi;
+    uint8_t id;
+    uint8_t info;   // phase, core << CORE_SHIFT
+} trace_evt_t;
+
+_Static_assert(sizeof(trace_evt_t) == 8, "trace event size");
+_Static_assert((APP_TRACE_EVENTS & (APP_TRACE_EVENTS - 1)) == 0,
+    "APP_TRACE_EVENTS must be a power of 2");
+
+static const struct {
+    const char* track;
+    const char* name;
+} ids[TRACE_N_IDS] = {
+    [TRACE_FEED_BLOCK]          = {"feed",  "feed_block"},
+    [TRACE_FEED_BEAM]           = {"feed",  "beamform"},
+    [TRACE_FEED_SDK_ADD]        = {"feed",  "trill_add_audio_block"},
+    [TRACE_FEED_WAKE]           = {"feed",  "listen_wake"},
+    [TRACE_PLAY_SDK_ACQUIRE]    = {"play",  "trill_acquire_audio_block"},
+    [TRACE_PLAY_I2S]            = {"play",  "i2s_write"},
+    [TRACE_TRILL_PROCESS]       = {"trill", "trill_process"},
+    [TRACE_SDK_CTS_SEARCH]      = {"trill", "cts_search"},
+    [TRACE_SDK_DEMOD]           = {"trill", "demod"},
+    [TRACE_SDK_PACKET_SENT]     = {"trill", "mod_packet_sent"},
+    [TRACE_SDK_ERROR]           = {"trill", "process_error"},
+    [TRACE_RX_PACKET]           = {"trill", "rx_packet"},
+    [TRACE_TX_SENT]             = {"trill", "tx_sent"},
+    [TRACE_UI_TICK]             = {"ui",    "ui_tick"},
+    [TRACE_UI_RENDER]           = {"ui",    "lv_task_handler"},
+    [TRACE_TXQ_SEND]            = {"txq",   "send_packet"},
+};
+
+static trace_evt_t* ring;
+static atomic_uint head;
+static volatile int paused;
+
+int trace_init(void)
+{
+    if (ring)
+        return 0;
+
+    // Off the internal heap, SDK needs it more than the trace.
+    ring = heap_caps_malloc(APP_TRACE_EVENTS * sizeof(trace_evt_t),
+                MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (ring == NULL)
+    {
+        printf("trace: ring alloc failed\n");
+        return -1;
+    }
+
+    atomic_store(&head, 0);
+    paused = 0;
+
+    return 0;
+}
+
+void trace_event(trace_id_t id, trace_phase_t ph)
+{
+    trace_evt_t* e;
+    uint64_t ts;
+
+    if ((ring == NULL) || paused)
+        return;
+
+    ts = (uint64_t) trace_now_us();
+    e = &ring[atomic_fetch_add(&head, 1) & (APP_TRACE_EVENTS - 1)];
+
+    e->ts_lo = (uint32_t) ts;
+    e->ts_hi = (uint16_t) (ts >> 32);
+    e->id = id;
+    e->info = (ph & PH_MASK) | (xPortGetCoreID() << CORE_SHIFT);
+}
+
+void trace_dump(void)
+{
+    unsigned int n, first, dropped;
+    const uint8_t* p;
+
+    if (ring == NULL)
+        return;
+
+    paused = 1;
+    // Let a writer that already took a slot finish it.
+    vTaskDelay(1);
+
+    n = atomic_load(&head);
+    dropped = (n > APP_TRACE_EVENTS) ? (n - APP_TRACE_EVENTS) : 0;
+    first = dropped;
+
+    printf("TRACE_START v%d events=%u dropped=%u\n", TRACE_VERSION, n - first, dropped);
+
+    for (int i = 0; i < TRACE_N_IDS; i++)
+    {
+        printf("TRACE_ID %d %s %s\n", i, ids[i].track, ids[i].name);
+    }
+
+    for (unsigned int i = first; i < n; i += EVENTS_PER_LINE)
+    {
+        printf("TRACE_DATA ");
+        for (unsigned int k = i; (k < n) && (k < i + EVENTS_PER_LINE); k++)
+        {
+            p = (const uint8_t*) &ring[k & (APP_TRACE_EVENTS - 1)];
+            for (int b = 0; b < sizeof(trace_evt_t); b++)
+            {
+                printf("%02x", p[b]);
+            }
+        }
+        printf("\n");
+    }
+
+    printf("TRACE_STOP\n");
+
+    atomic_store(&head, 0);
+    paused = 0;
+}
@@ -0,0 +1,595 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_system.h"
+
+#include "trill.h"
+#include "trill_error.h"
+#include "app_config.h"
+#include "tx_queue.h"
+#include "transport.h"
+
+#define XPORT_TYPE_FRAG     0xF1
+#define XPORT_TYPE_ACK      0xF2
+#define XPORT_TYPE_PARITY   0xF3
+#define XPORT_ACK_LEN       6
+#define XPORT_PARITY_LEN    (XPORT_PARITY_HDR_LEN + XPORT_FRAG_DATA_LEN)
+#define ORDER_PARITY        0x80
+#define COUNT_PARITY        0x80    // fragment count flag, parity follows in burst
+
+#if APP_XPORT_FEC_GROUP > 0
+#define XPORT_MAX_GROUPS    ((XPORT_MAX_FRAGS + APP_XPORT_FEC_GROUP - 1) / APP_XPORT_FEC_GROUP)
+#else
+#define XPORT_MAX_GROUPS    1
+#endif
+
+typedef enum {
+    XPORT_TX_IDLE = 0,
+    XPORT_TX_SENDING,
+    XPORT_TX_DRAINING,
+    XPORT_TX_WAIT_ACK,
+    XPORT_TX_DONE
+} xport_tx_state_t;
+
+static SemaphoreHandle_t lock;
+static xport_rx_cb_t rx_cb;
+static xport_tx_done_cb_t tx_done_cb;
+
+static struct {
+    xport_tx_state_t state;
+    trill_tx_params_t params;
+    uint8_t id;
+    uint8_t count;
+    uint8_t next;
+    uint8_t n_order;
+    int fec;
+    uint8_t order[XPORT_MAX_FRAGS + XPORT_MAX_GROUPS];
+    unsigned int len;
+    uint32_t acked;
+    unsigned int round;
+    int result;
+    TickType_t deadline;
+    unsigned int n_frags_sent;
+    TickType_t started;
+    uint8_t buf[XPORT_MAX_MSG_LEN];
+} tx;
+
+static struct {
+    int active;
+    uint8_t id;
+    uint8_t count;
+    uint32_t received;
+    uint32_t parity_have;
+    uint8_t fec_group;
+    unsigned int last_len;
+    unsigned int n_recovered;
+    int ack_due;
+    int ack_hold;
+    unsigned int idle_acks;
+    TickType_t last_rx;
+    int done_valid;
+    uint8_t done_id;
+    uint8_t done_count;
+    trill_tx_params_t ack_params;
+    uint8_t buf[XPORT_MAX_MSG_LEN];
+    uint8_t parity[XPORT_MAX_GROUPS][XPORT_FRAG_DATA_LEN];
+} rx;
+
+static uint32_t all_frags(uint8_t count)
+{
+    return (count >= 32) ? 0xFFFFFFFFu : ((1u << count) - 1);
+}
+
+static unsigned int frag_len(uint8_t idx, uint8_t count, unsigned int total)
+{
+    return (idx == (count - 1)) ? (total - idx * XPORT_FRAG_DATA_LEN) : XPORT_FRAG_DATA_LEN;
+}
+
+static int send_ack(uint8_t id, uint32_t bitmap)
+{
+    uint8_t pkt[XPORT_ACK_LEN];
+
+    pkt[0] = XPORT_TYPE_ACK;
+    pkt[1] = id;
+    pkt[2] = bitmap & 0xFF;
+    pkt[3] = (bitmap >> 8) & 0xFF;
+    pkt[4] = (bitmap >> 16) & 0xFF;
+    pkt[5] = (bitmap >> 24) & 0xFF;
+
+    return tx_queue_send(&rx.ack_params, pkt, sizeof(pkt), NULL);
+}
+
+static void tx_report(void)
+{
+    int result = tx.result;
+    TickType_t elapsed = xTaskGetTickCount() - tx.started;
+
+    printf("xport: msg %u %s, %u bytes, %u rounds, %u packets sent, %u ms",
+        tx.id, result == 0 ? "delivered" : "failed", tx.len, tx.round, 
+        tx.n_frags_sent, (unsigned int) pdTICKS_TO_MS(elapsed));
+    if ((result == 0) && elapsed)
+    {
+        printf(", goodput %u bit/s", 
+            (unsigned int) ((tx.len * 8ull * 1000) / pdTICKS_TO_MS(elapsed)));
+    }
+    printf("\n");
+
+    tx.state = XPORT_TX_IDLE;
+    if (tx_done_cb)
+        tx_done_cb(result);
+}
+
+static void tx_finish(int result)
+{
+    // Reported from xport_poll.
+    tx.result = result;
+    tx.state = XPORT_TX_DONE;
+}
+
+static void tx_start_round(void)
+{
+    int fec = (tx.round == 0) && (APP_XPORT_FEC_GROUP > 0);
+    // Keeps the divisions below valid when FEC is disabled.
+    const unsigned int group = (APP_XPORT_FEC_GROUP > 0) ? APP_XPORT_FEC_GROUP : 1;
+
+    tx.round++;
+    tx.next = 0;
+    tx.n_order = 0;
+    tx.fec = fec;
+
+    // Missing fragments, each group followed by its parity in first round.
+    for (uint8_t i = 0; i < tx.count; i++)
+    {
+        if ((tx.acked & (1u << i)) == 0)
+            tx.order[tx.n_order++] = i;
+
+        if (fec && ((((i + 1) % group) == 0) || (i == (tx.count - 1))))
+            tx.order[tx.n_order++] = ORDER_PARITY | (i / group);
+    }
+
+    tx.state = XPORT_TX_SENDING;
+}
+
+static unsigned int build_parity(uint8_t group, uint8_t* pkt)
+{
+    unsigned int first = group * APP_XPORT_FEC_GROUP;
+    unsigned int end = first + APP_XPORT_FEC_GROUP;
+    uint8_t* xor = &pkt[XPORT_PARITY_HDR_LEN];
+
+    if (end > tx.count)
+        end = tx.count;
+
+    pkt[0] = XPORT_TYPE_PARITY;
+    pkt[1] = tx.id;
+    pkt[2] = group;
+    pkt[3] = tx.count;
+    pkt[4] = frag_len(tx.count - 1, tx.count, tx.len);
+    pkt[5] = APP_XPORT_FEC_GROUP;
+
+    memset(xor, 0, XPORT_FRAG_DATA_LEN);
+    for (unsigned int i = first; i < end; i++)
+    {
+        const uint8_t* d = &tx.buf[i * XPORT_FRAG_DATA_LEN];
+        unsigned int n = frag_len(i, tx.count, tx.len);
+
+        for (unsigned int k = 0; k < n; k++)
+            xor[k] ^= d[k];
+    }
+
+    return XPORT_PARITY_LEN;
+}
+
+int xport_init(xport_rx_cb_t rx_callback, xport_tx_done_cb_t tx_done_callback)
+{
+    if (lock == NULL)
+    {
+        lock = xSemaphoreCreateMutex();
+        if (lock == NULL)
+            return -1;
+    }
+
+    rx_cb = rx_callback;
+    tx_done_cb = tx_done_callback;
+    // Not from 0 on every boot, receivers remember the last id.
+    tx.id = esp_random();
+    xport_reset();
+
+    return 0;
+}
+
+void xport_reset(void)
+{
+    xSemaphoreTake(lock, portMAX_DELAY);
+    tx.state = XPORT_TX_IDLE;
+    rx.active = 0;
+    rx.ack_due = 0;
+    rx.ack_hold = 0;
+    rx.done_valid = 0;
+    // ACKs are short, send them with the most robust config.
+    rx.ack_params.ssi = SSI_PLAIN_TEXT;
+    rx.ack_params.ck_nonce = NULL;
+    rx.ack_params.data_cfg_range = TRILL_DATA_CFG_RANGE_FAR;
+    xSemaphoreGive(lock);
+}
+
+int xport_send(const trill_tx_params_t* params, const uint8_t* msg, unsigned int len)
+{
+    int ret = 0;
+
+    if ((len == 0) || (len > XPORT_MAX_MSG_LEN))
+        return TRILL_ERR_DATALINK_PAYLOAD_TOO_LONG;
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+
+    if (tx.state != XPORT_TX_IDLE)
+    {
+        ret = -1;
+    }
+    else
+    {
+        tx.params = *params;
+        tx.id++;
+        tx.len = len;
+        tx.count = (len + XPORT_FRAG_DATA_LEN - 1) / XPORT_FRAG_DATA_LEN;
+        tx.acked = 0;
+        tx.round = 0;
+        tx.n_frags_sent = 0;
+        tx.started = xTaskGetTickCount();
+        memcpy(tx.buf, msg, len);
+        tx_start_round();
+    }
+
+    xSemaphoreGive(lock);
+
+    return ret;
+}
+
+/* 
+    ACK at the end of sender's burst, else once it went quiet: without
+    listen before talk it would cut into the rest of the burst.
+*/
+static void rx_ack(int burst_end)
+{
+    if (burst_end)
+    {
+        rx.ack_hold = 0;
+        rx.ack_due = 1;
+    }
+    else
+    {
+        rx.ack_hold = 1;
+    }
+}
+
+static int rx_begin(uint8_t id, uint8_t count)
+{
+    if (rx.done_valid && (rx.done_id == id) && (rx.done_count == count))
+    {
+        // Sender missed our final ACK and resends.
+        rx.last_rx = xTaskGetTickCount();
+        rx_ack(0);
+        return -1;
+    }
+
+    if (!rx.active || (rx.id != id) || (rx.count != count))
+    {
+        rx.active = 1;
+        rx.ack_hold = 0;
+        rx.id = id;
+        rx.count = count;
+        rx.received = 0;
+        rx.parity_have = 0;
+        rx.fec_group = 0;
+    }
+
+    rx.last_rx = xTaskGetTickCount();
+    rx.idle_acks = 0;
+
+    return 0;
+}
+
+static unsigned int rx_frag_len(unsigned int idx)
+{
+    return (idx == ((unsigned int) rx.count - 1)) ? rx.last_len : XPORT_FRAG_DATA_LEN;
+}
+
+static void rx_try_recover(unsigned int group)
+{
+    unsigned int first = group * rx.fec_group;
+    unsigned int end = first + rx.fec_group;
+    uint32_t missing;
+    unsigned int lost;
+
+    if ((rx.fec_group == 0) || (group >= XPORT_MAX_GROUPS) ||
+        ((rx.parity_have & (1u << group)) == 0))
+        return;
+
+    if (end > rx.count)
+        end = rx.count;
+
+    missing = (all_frags(end) & ~all_frags(first)) & ~rx.received;
+    if ((missing == 0) || (missing & (missing - 1)))
+        return; // nothing or more than one lost.
+
+    lost = __builtin_ctz(missing);
+
+    uint8_t* dst = &rx.buf[lost * XPORT_FRAG_DATA_LEN];
+    memcpy(dst, rx.parity[group], rx_frag_len(lost));
+
+    for (unsigned int i = first; i < end; i++)
+    {
+        if (i == lost)
+            continue;
+
+        const uint8_t* d = &rx.buf[i * XPORT_FRAG_DATA_LEN];
+        unsigned int n = rx_frag_len(i);
+        for (unsigned int k = 0; k < n; k++)
+            dst[k] ^= d[k];
+    }
+
+    rx.received |= missing;
+    rx.n_recovered++;
+}
+
+static int rx_check_complete(void)
+{
+    if (rx.received != all_frags(rx.count))
+        return 0;
+
+    unsigned int total = (rx.count - 1) * XPORT_FRAG_DATA_LEN + rx.last_len;
+
+    rx.active = 0;
+    rx.done_valid = 1;
+    rx.done_id = rx.id;
+    rx.done_count = rx.count;
+
+    if (rx.n_recovered)
+        printf("xport: %u fragments rebuilt from parity\n", rx.n_recovered);
+    rx.n_recovered = 0;
+
+    if (rx_cb)
+        rx_cb(rx.buf, total);
+
+    return 1;
+}
+
+static void on_frag(const uint8_t* pkt, unsigned int len)
+{
+    uint8_t id = pkt[1];
+    uint8_t idx = pkt[2];
+    uint8_t count = pkt[3] & ~COUNT_PARITY;
+    int parity_follows = pkt[3] & COUNT_PARITY;
+    unsigned int data_len = len - XPORT_HDR_LEN;
+
+    if ((count == 0) || (count > XPORT_MAX_FRAGS) || (idx >= count) ||
+        (data_len > XPORT_FRAG_DATA_LEN) || 
+        ((idx < (count - 1)) && (data_len != XPORT_FRAG_DATA_LEN)))
+    {
+        return;
+    }
+
+    if (rx_begin(id, count) < 0)
+    {
+        // Highest index ends a resend burst.
+        if ((idx == (count - 1)) && !parity_follows)
+            rx_ack(1);
+        return;
+    }
+
+    memcpy(&rx.buf[idx * XPORT_FRAG_DATA_LEN], &pkt[XPORT_HDR_LEN], data_len);
+    if (idx == (count - 1))
+        rx.last_len = data_len;
+    rx.received |= (1u << idx);
+
+    if (rx.fec_group)
+        rx_try_recover(idx / rx.fec_group);
+
+    // With parity the burst ends with the last group's parity.
+    if (rx_check_complete())
+    {
+        rx_ack(!parity_follows);
+        return;
+    }
+
+    // End of burst, report what is missing. 
+    if ((idx == (count - 1)) && !parity_follows)
+        rx_ack(1);
+}
+
+static void on_parity(const uint8_t* pkt)
+{
+    uint8_t id = pkt[1];
+    uint8_t group = pkt[2];
+    uint8_t count = pkt[3];
+    uint8_t last_len = pkt[4];
+    uint8_t group_size = pkt[5];
+    int last_group;
+
+    if ((count == 0) || (count > XPORT_MAX_FRAGS) || (group_size == 0) ||
+        (group >= XPORT_MAX_GROUPS) || ((group * group_size) >= count) ||
+        (last_len == 0) || (last_len > XPORT_FRAG_DATA_LEN))
+    {
+        return;
+    }
+
+    last_group = (group == ((count - 1) / group_size));
+
+    // Last group's parity trails a message already complete without it.
+    // Not a sign of a lost ACK, that shows as a repeated fragment.
+    if (rx.done_valid && (rx.done_id == id) && (rx.done_count == count))
+    {
+        rx.last_rx = xTaskGetTickCount();
+        if (rx.ack_hold && last_group)
+            rx_ack(1);
+        return;
+    }
+
+    if (rx_begin(id, count) < 0)
+        return;
+
+    memcpy(rx.parity[group], &pkt[XPORT_PARITY_HDR_LEN], XPORT_FRAG_DATA_LEN);
+    rx.parity_have |= (1u << group);
+    rx.fec_group = group_size;
+    rx.last_len = last_len;
+
+    rx_try_recover(group);
+
+    if (rx_check_complete() || last_group)
+        rx_ack(last_group);
+}
+
+static void on_ack(const uint8_t* pkt)
+{
+    uint32_t bitmap = pkt[2] | (pkt[3] << 8) | (pkt[4] << 16) | ((uint32_t) pkt[5] << 24);
+
+    if ((tx.state == XPORT_TX_IDLE) || (tx.state == XPORT_TX_DONE) || 
+        (pkt[1] != tx.id))
+        return;
+
+    tx.acked |= bitmap & all_frags(tx.count);
+
+    if (tx.acked == all_frags(tx.count))
+    {
+        tx_finish(0);
+    }
+    else if (tx.state == XPORT_TX_WAIT_ACK)
+    {
+        tx_start_round();
+    }
+}
+
+int xport_on_rx(const uint8_t* pkt, unsigned int len)
+{
+    if ((len < 2) || ((pkt[0] != XPORT_TYPE_FRAG) && 
+        (pkt[0] != XPORT_TYPE_ACK) && (pkt[0] != XPORT_TYPE_PARITY)))
+        return 0;
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+
+    if ((pkt[0] == XPORT_TYPE_FRAG) && (len > XPORT_HDR_LEN))
+        on_frag(pkt, len);
+    else if ((pkt[0] == XPORT_TYPE_ACK) && (len == XPORT_ACK_LEN))
+        on_ack(pkt);
+    else if ((pkt[0] == XPORT_TYPE_PARITY) && (len == XPORT_PARITY_LEN))
+        on_parity(pkt);
+
+    xSemaphoreGive(lock);
+
+    return 1;
+}
+
+static void poll_tx(TickType_t now)
+{
+    uint8_t pkt[TRILL_MAX_DATA_PAYLOAD_LEN];
+    unsigned int n;
+
+    switch (tx.state)
+    {
+        case XPORT_TX_SENDING:
+            // Queue this round's packets as long as TX queue takes them.
+            while ((tx.next < tx.n_order) && tx_queue_space())
+            {
+                uint8_t code = tx.order[tx.next];
+
+                if (code & ORDER_PARITY)
+                {
+                    n = build_parity(code & ~ORDER_PARITY, pkt);
+                }
+                else
+                {
+                    n = frag_len(code, tx.count, tx.len);
+                    pkt[0] = XPORT_TYPE_FRAG;
+                    pkt[1] = tx.id;
+                    pkt[2] = code;
+                    pkt[3] = tx.count | (tx.fec ? COUNT_PARITY : 0);
+                    memcpy(&pkt[XPORT_HDR_LEN], &tx.buf[code * XPORT_FRAG_DATA_LEN], n);
+                    n += XPORT_HDR_LEN;
+                }
+
+                if (tx_queue_send(&tx.params, pkt, n, NULL) < 0)
+                    return;
+
+                tx.next++;
+                tx.n_frags_sent++;
+            }
+
+            if (tx.next == tx.n_order)
+                tx.state = XPORT_TX_DRAINING;
+            break;
+        case XPORT_TX_DRAINING:
+            if (!tx_queue_in_burst())
+            {
+                tx.deadline = now + pdMS_TO_TICKS(APP_XPORT_ACK_TIMEOUT_MS);
+                tx.state = XPORT_TX_WAIT_ACK;
+            }
+            break;
+        case XPORT_TX_WAIT_ACK:
+            if ((int32_t)(now - tx.deadline) >= 0)
+            {
+                if (tx.round >= APP_XPORT_MAX_ROUNDS)
+                    tx_finish(TRILL_ERR_DATA_DEC_CRC_CHECK_FAILED);
+                else
+                    tx_start_round();
+            }
+            break;
+        case XPORT_TX_DONE:
+            tx_report();
+            break;
+        default:
+            break;
+    }
+}
+
+static void poll_rx(TickType_t now)
+{
+    if (rx.ack_hold && ((now - rx.last_rx) >= pdMS_TO_TICKS(APP_XPORT_ACK_HOLD_MS)))
+        rx_ack(1);
+
+    // Fragments stopped arriving before the last one, ACK what we have.
+    // Sender gives up after as many rounds, so does the receiver.
+    if (rx.active && !rx.ack_due && 
+        ((now - rx.last_rx) >= pdMS_TO_TICKS(APP_XPORT_RX_IDLE_MS)))
+    {
+        if (rx.idle_acks >= APP_XPORT_MAX_ROUNDS)
+        {
+            printf("xport: msg %u incomplete, dropped\n", rx.id);
+            rx.active = 0;
+        }
+        else
+        {
+            rx.idle_acks++;
+            rx.ack_due = 1;
+            rx.last_rx = now;
+        }
+    }
+
+    if (rx.ack_due && !tx_queue_in_burst())
+    {
+        uint8_t id = rx.active ? rx.id : rx.done_id;
+        uint32_t bitmap = rx.active ? rx.received : 0xFFFFFFFFu;
+
+        if (send_ack(id, bitmap) == 0)
+            rx.ack_due = 0;
+    }
+}
+
+int xport_tx_busy(void)
+{
+    return tx.state != XPORT_TX_IDLE;
+}
+
+void xport_poll(void)
+{
+    TickType_t now = xTaskGetTickCount();
+
+    if (lock == NULL)
+        return;
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    poll_tx(now);
+    poll_rx(now);
+    xSemaphoreGive(lock);
+}
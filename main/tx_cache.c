@@ -0,0 +1,335 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_heap_caps.h"
+
+#include "trill.h"
+#include "app_config.h"
+#include "tx_cache.h"
+
+#define CAPTURE_END_TIMEOUT_MS  1000
+
+typedef enum {
+    TX_CACHE_EMPTY = 0,
+    TX_CACHE_CAPTURING,
+    TX_CACHE_READY
+} tx_cache_state_t;
+
+struct tx_cache_entry {
+    tx_cache_state_t state;
+    unsigned int last_used;
+    trill_data_encryption_scheme_t ssi;
+    trill_data_config_range_t data_cfg_range;
+    unsigned int len;
+    unsigned char data[TRILL_MAX_DATA_PAYLOAD_LEN];
+    int16_t* samples;
+    unsigned int n_samples;
+    unsigned int cap_samples;
+};
+
+static tx_cache_entry_t entries[APP_TX_CACHE_ENTRIES];
+static unsigned int use_clock;
+static size_t total_bytes;
+static unsigned int n_hits;
+static unsigned int n_misses;
+static unsigned int n_evictions;
+
+static SemaphoreHandle_t capture_done;
+static tx_cache_entry_t* volatile capture_entry;
+static volatile int capture_mute;
+static volatile int capture_sdk_done;
+static volatile int capture_failed;
+
+// Play task only copies into it, entry buffer is sized at capture end.
+static int16_t* stage;
+static unsigned int stage_n;
+
+static tx_cache_entry_t* volatile play_entry;
+static unsigned int play_pos;
+static tx_cache_play_done_cb_t play_done_cb;
+
+static void entry_free(tx_cache_entry_t* e)
+{
+    if (e->samples)
+    {
+        heap_caps_free(e->samples);
+        total_bytes -= e->cap_samples * sizeof(int16_t);
+    }
+
+    e->samples = NULL;
+    e->n_samples = 0;
+    e->cap_samples = 0;
+    e->state = TX_CACHE_EMPTY;
+}
+
+static tx_cache_entry_t* lru_ready_entry(const tx_cache_entry_t* except)
+{
+    tx_cache_entry_t* lru = NULL;
+
+    for (int i = 0; i < APP_TX_CACHE_ENTRIES; i++)
+    {
+        tx_cache_entry_t* e = &entries[i];
+
+        if ((e == except) || (e->state != TX_CACHE_READY))
+            continue;
+
+        if ((lru == NULL) || ((int)(e->last_used - lru->last_used) < 0))
+            lru = e;
+    }
+
+    return lru;
+}
+
+static int key_match(const tx_cache_entry_t* e, const trill_tx_params_t* params, 
+        const unsigned char* data, unsigned int data_len)
+{
+    return (e->ssi == params->ssi) &&
+        (e->data_cfg_range == params->data_cfg_range) &&
+        (e->len == data_len) &&
+        (memcmp(e->data, data, data_len) == 0);
+}
+
+int tx_cache_init(void)
+{
+    if (capture_done == NULL)
+    {
+        capture_done = xSemaphoreCreateBinary();
+        if (capture_done == NULL)
+            return -1;
+    }
+
+    if ((stage == NULL) && (APP_TX_CACHE_ENTRIES > 0))
+    {
+        stage = heap_caps_malloc(APP_TX_CACHE_CAPTURE_BYTES, MALLOC_CAP_SPIRAM);
+        if (stage == NULL)
+            printf("tx cache: no capture buffer, cache off\n");
+    }
+
+    return 0;
+}
+
+int tx_cache_is_cacheable(const trill_tx_params_t* params)
+{
+    return (APP_TX_CACHE_ENTRIES > 0) &&
+        (params->ssi == SSI_PLAIN_TEXT) && 
+        (params->ck_nonce == NULL);
+}
+
+tx_cache_entry_t* tx_cache_find(const trill_tx_params_t* params, 
+        const unsigned char* data, unsigned int data_len)
+{
+    if (!tx_cache_is_cacheable(params))
+        return NULL;
+
+    for (int i = 0; i < APP_TX_CACHE_ENTRIES; i++)
+    {
+        tx_cache_entry_t* e = &entries[i];
+
+        if ((e->state == TX_CACHE_READY) && key_match(e, params, data, data_len))
+        {
+            e->last_used = ++use_clock;
+            n_hits++;
+            return e;
+        }
+    }
+
+    n_misses++;
+    return NULL;
+}
+
+tx_cache_entry_t* tx_cache_capture_begin(const trill_tx_params_t* params, 
+        const unsigned char* data, unsigned int data_len, int mute)
+{
+    tx_cache_entry_t* e = NULL;
+
+    if (!tx_cache_is_cacheable(params) || (capture_done == NULL) ||
+        (stage == NULL) || (data_len > TRILL_MAX_DATA_PAYLOAD_LEN))
+        return NULL;
+
+    for (int i = 0; i < APP_TX_CACHE_ENTRIES; i++)
+    {
+        if (entries[i].state == TX_CACHE_EMPTY)
+        {
+            e = &entries[i];
+            break;
+        }
+    }
+
+    if (e == NULL)
+    {
+        e = lru_ready_entry(NULL);
+        if (e == NULL)
+            return NULL;
+        entry_free(e);
+        n_evictions++;
+    }
+
+    e->ssi = params->ssi;
+    e->data_cfg_range = params->data_cfg_range;
+    e->len = data_len;
+    memcpy(e->data, data, data_len);
+    e->last_used = ++use_clock;
+    e->state = TX_CACHE_CAPTURING;
+
+    xSemaphoreTake(capture_done, 0);
+    capture_mute = mute;
+    capture_sdk_done = 0;
+    capture_failed = 0;
+    stage_n = 0;
+    capture_entry = e;
+
+    return e;
+}
+
+/* TX queue task, capture is complete in stage. */
+static int entry_store(tx_cache_entry_t* e)
+{
+    size_t bytes = stage_n * sizeof(int16_t);
+
+    // No packet is playing while TX queue task is here, safe to evict.
+    while ((total_bytes + bytes) > APP_TX_CACHE_MAX_BYTES)
+    {
+        tx_cache_entry_t* lru = lru_ready_entry(e);
+        if (lru == NULL)
+            return -1;
+        entry_free(lru);
+        n_evictions++;
+    }
+
+    e->samples = heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM);
+    if (e->samples == NULL)
+        return -1;
+
+    memcpy(e->samples, stage, bytes);
+    e->n_samples = stage_n;
+    e->cap_samples = stage_n;
+    total_bytes += bytes;
+    e->state = TX_CACHE_READY;
+
+    return 0;
+}
+
+int tx_cache_capture_end(int ok)
+{
+    tx_cache_entry_t* e = capture_entry;
+
+    if (e == NULL)
+        return -1;
+
+    if (!ok)
+        capture_failed = 1;
+    
+    capture_sdk_done = 1;
+
+    if (xSemaphoreTake(capture_done, pdMS_TO_TICKS(CAPTURE_END_TIMEOUT_MS)) != pdTRUE)
+    {
+        // Play task is gone, finish here.
+        capture_entry = NULL;
+        entry_free(e);
+        return -1;
+    }
+
+    if (capture_failed || (stage_n == 0) || (entry_store(e) < 0))
+    {
+        entry_free(e);
+        return -1;
+    }
+
+    return 0;
+}
+
+int tx_cache_play_start(tx_cache_entry_t* entry, tx_cache_play_done_cb_t done_cb)
+{
+    if ((entry == NULL) || (entry->state != TX_CACHE_READY))
+        return -1;
+
+    play_done_cb = done_cb;
+    play_pos = 0;
+    play_entry = entry;
+
+    return 0;
+}
+
+void tx_cache_play_stop(void)
+{
+    play_entry = NULL;
+}
+
+int tx_cache_play_block(int16_t* block, unsigned int n_samples)
+{
+    tx_cache_entry_t* e = play_entry;
+    unsigned int n;
+
+    if (e == NULL)
+        return 0;
+
+    n = e->n_samples - play_pos;
+    if (n > n_samples)
+        n = n_samples;
+
+    memcpy(block, &e->samples[play_pos], n * sizeof(int16_t));
+    memset(&block[n], 0, (n_samples - n) * sizeof(int16_t));
+    play_pos += n;
+
+    if (play_pos >= e->n_samples)
+    {
+        play_entry = NULL;
+        if (play_done_cb)
+            play_done_cb();
+    }
+
+    return 1;
+}
+
+int tx_cache_sdk_block(const int16_t* block, unsigned int n_samples)
+{
+    tx_cache_entry_t* e = capture_entry;
+
+    if (e == NULL)
+        return 0;
+
+    // Muted capture stays muted to its end, also when not cached.
+    if (capture_failed)
+        return capture_mute;
+
+    if ((stage_n + n_samples) * sizeof(int16_t) > APP_TX_CACHE_CAPTURE_BYTES)
+    {
+        printf("tx cache: waveform over capture buffer, not cached\n");
+        capture_failed = 1;
+        return capture_mute;
+    }
+
+    memcpy(&stage[stage_n], block, n_samples * sizeof(int16_t));
+    stage_n += n_samples;
+
+    return capture_mute;
+}
+
+void tx_cache_sdk_idle(void)
+{
+    tx_cache_entry_t* e = capture_entry;
+
+    // SDK reported packet sent and its TX ring is drained.
+    if ((e == NULL) || !capture_sdk_done)
+        return;
+
+    // Stored by tx_cache_capture_end, not from the real time path.
+    capture_entry = NULL;
+    xSemaphoreGive(capture_done);
+}
+
+void tx_cache_print_stats(void)
+{
+    unsigned int n_ready = 0;
+
+    for (int i = 0; i < APP_TX_CACHE_ENTRIES; i++)
+    {
+        if (entries[i].state == TX_CACHE_READY)
+            n_ready++;
+    }
+
+    printf("tx cache: entries %u/%u, bytes %u, hits %u, misses %u, evictions %u\n",
+        n_ready, APP_TX_CACHE_ENTRIES, (unsigned int) total_bytes, n_hits, n_misses, n_evictions);
+}
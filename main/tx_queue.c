@@ -0,0 +1,390 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdatomic.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+
+#include "trill.h"
+#include "trill_error.h"
+#include "app_config.h"
+#include "tx_queue.h"
+#include "tx_cache.h"
+#include "trace.h"
+#include "lbt.h"
+
+#define TX_QUEUE_TASK_STACK_SIZE    (3*1024)
+#define TX_NOTIFY_SENT              (1<<0)
+#define TX_NOTIFY_STOP              (1<<1)
+
+typedef enum {
+    TX_PKT_SEND,
+    TX_PKT_PREPARE,
+    TX_PKT_REPLY,       // sent next, without listen before talk
+} tx_packet_mode_t;
+
+typedef struct {
+    unsigned int id;
+    tx_packet_mode_t mode;
+    trill_tx_params_t params;
+    unsigned int len;
+    unsigned char data[TRILL_MAX_DATA_PAYLOAD_LEN];
+} tx_packet_t;
+
+static QueueHandle_t tx_packets;
+static SemaphoreHandle_t tx_stopped;
+static TaskHandle_t tx_task_handle;
+static void* tx_trill_handle;
+static tx_queue_done_cb_t done_cb;
+static atomic_uint next_id;       // enqueue runs from app and trill tasks
+static volatile int in_burst;
+static volatile int contending;
+static volatile int preparing;
+static atomic_uint n_queued;     // queued packets to be played
+static volatile int stop_req;
+static volatile int lbt_abort;  // stop or reply queued, ends channel wait
+
+static void report(unsigned int id, int result)
+{
+    if (done_cb)
+        done_cb(id, result);
+}
+
+static int wait_sent(void)
+{
+    uint32_t notified = 0;
+
+    xTaskNotifyWait(0, TX_NOTIFY_SENT | TX_NOTIFY_STOP, &notified, 
+        pdMS_TO_TICKS(APP_TX_SENT_TIMEOUT_MS));
+    
+    if (notified & TX_NOTIFY_STOP)
+        return TRILL_ERR_USER_ABORTED_TX;
+    else if ((notified & TX_NOTIFY_SENT) == 0)
+        return -1;
+
+    return 0;
+}
+
+static int send_packet(tx_packet_t* pkt)
+{
+    int ret;
+    tx_cache_entry_t* entry;
+    
+    entry = tx_cache_find(&pkt->params, pkt->data, pkt->len);
+    if (entry)
+    {
+        if (pkt->mode == TX_PKT_PREPARE)
+            return 0;
+
+        // Replay stored waveform, modulator is not used.
+        ret = tx_cache_play_start(entry, tx_queue_on_sent);
+        if (ret == 0)
+        {
+            ret = wait_sent();
+            if (ret < 0)
+                tx_cache_play_stop();
+            return ret;
+        }
+    }
+
+    entry = tx_cache_capture_begin(&pkt->params, pkt->data, pkt->len, 
+                pkt->mode == TX_PKT_PREPARE);
+    if ((entry == NULL) && (pkt->mode == TX_PKT_PREPARE))
+    {
+        printf("tx queue: packet %u can not be prepared\n", pkt->id);
+        return TRILL_ERR_INVALID_PARAMETERS;
+    }
+
+    ret = trill_tx_data(tx_trill_handle, &pkt->params, pkt->data, pkt->len);
+    if (ret < 0)
+    {
+        printf("tx queue: trill_tx_data(%u) = %d\n", pkt->id, ret);
+    }
+    else
+    {
+        ret = wait_sent();
+        // Timed out, SDK would still hold the packet. On stop the
+        // owner of the handle aborts.
+        if ((ret == -1) && (trill_tx_abort(tx_trill_handle) < 0))
+            printf("tx queue: packet %u not aborted\n", pkt->id);
+    }
+
+    if (entry)
+    {
+        tx_cache_capture_end(ret == 0);
+    }
+
+    return ret;
+}
+
+static int play(tx_packet_t* pkt)
+{
+    int ret;
+
+    // Drop stale notifications from previous packets.
+    xTaskNotifyWait(0, TX_NOTIFY_SENT, NULL, 0);
+
+    TRACE_BEGIN(TRACE_TXQ_SEND);
+    ret = send_packet(pkt);
+    TRACE_END(TRACE_TXQ_SEND);
+
+    return ret;
+}
+
+/* 
+    Wait for the channel before first packet of a burst. A reply queued
+    meanwhile goes out first, the wait starts over after it.
+*/
+static int contend(void)
+{
+    static tx_packet_t reply;
+    int ret;
+
+    while (1)
+    {
+        lbt_abort = 0;
+        if (stop_req)
+            return -1;
+
+        if ((xQueuePeek(tx_packets, &reply, 0) == pdTRUE) && (reply.mode == TX_PKT_REPLY))
+        {
+            xQueueReceive(tx_packets, &reply, 0);
+            atomic_fetch_sub(&n_queued, 1);
+
+            contending = 0;
+            report(reply.id, play(&reply));
+            vTaskDelay(pdMS_TO_TICKS(APP_TX_GUARD_MS));
+            contending = 1;
+            continue;
+        }
+
+        ret = lbt_acquire(&lbt_abort);
+        if (ret >= 0)
+            return ret;
+    }
+}
+
+static void tx_queue_task(void* arg)
+{
+    static tx_packet_t pkt;
+    int ret;
+    int more;
+
+    (void) arg;
+
+    while (!stop_req)
+    {
+        if (xQueueReceive(tx_packets, &pkt, pdMS_TO_TICKS(100)) != pdTRUE)
+        {
+            continue;
+        }
+
+        // Silent, not on air: no channel contention, mic keeps feeding.
+        if (pkt.mode == TX_PKT_PREPARE)
+        {
+            preparing = 1;
+            xTaskNotifyWait(0, TX_NOTIFY_SENT, NULL, 0);
+            ret = send_packet(&pkt);
+            preparing = 0;
+
+            if (atomic_load(&n_queued) == 0)
+                in_burst = 0;
+
+            report(pkt.id, ret);
+            continue;
+        }
+
+        // Burst holds the channel once won, only its first packet contends.
+        // in_burst is set before the queued count drops, never reads idle.
+        contending = !in_burst && (pkt.mode != TX_PKT_REPLY);
+        in_burst = 1;
+        atomic_fetch_sub(&n_queued, 1);
+
+        if (contending && (contend() > 0))
+            printf("tx queue: channel still busy, packet %u sent anyway\n", pkt.id);
+        contending = 0;
+
+        // Stopped while waiting for the channel.
+        if (stop_req)
+        {
+            report(pkt.id, TRILL_ERR_USER_ABORTED_TX);
+            break;
+        }
+
+        ret = play(&pkt);
+
+        more = !stop_req && atomic_load(&n_queued);
+        if (!more)
+        {
+            in_burst = 0;
+        }
+
+        report(pkt.id, ret);
+
+        if (more)
+        {
+            // Next packet of the burst. Keep mic paused.
+            vTaskDelay(pdMS_TO_TICKS(APP_TX_GUARD_MS));
+        }
+    }
+
+    // Fail whatever was left.
+    while (xQueueReceive(tx_packets, &pkt, 0) == pdTRUE)
+    {
+        report(pkt.id, TRILL_ERR_USER_ABORTED_TX);
+    }
+    atomic_store(&n_queued, 0);
+
+    in_burst = 0;
+    xSemaphoreGive(tx_stopped);
+    vTaskDelete(NULL);
+}
+
+int tx_queue_start(void* trill_handle, tx_queue_done_cb_t cb)
+{
+    int ret;
+
+    if (tx_packets == NULL)
+    {
+        tx_packets = xQueueCreate(APP_TX_QUEUE_DEPTH, sizeof(tx_packet_t));
+        tx_stopped = xSemaphoreCreateBinary();
+        if ((tx_packets == NULL) || (tx_stopped == NULL) || 
+            (tx_cache_init() < 0))
+        {
+            printf("tx queue: create failed\n");
+            return -1;
+        }
+    }
+
+    tx_trill_handle = trill_handle;
+    done_cb = cb;
+    stop_req = 0;
+    lbt_abort = 0;
+    in_burst = 0;
+
+    ret = xTaskCreatePinnedToCore(&tx_queue_task, "txq", TX_QUEUE_TASK_STACK_SIZE, 
+            NULL, 4, &tx_task_handle, 0);
+    if (ret != pdPASS)
+    {
+        printf("tx queue task create failed: %d\n", ret);
+        return -1;
+    }
+
+    return 0;
+}
+
+int tx_queue_stop(void)
+{
+    if (tx_task_handle == NULL)
+    {
+        return 0;
+    }
+
+    stop_req = 1;
+    lbt_abort = 1;
+    tx_cache_play_stop();
+    xTaskNotify(tx_task_handle, TX_NOTIFY_STOP, eSetBits);
+    xSemaphoreTake(tx_stopped, portMAX_DELAY);
+    tx_task_handle = NULL;
+
+    return 0;
+}
+
+static int enqueue(tx_packet_mode_t mode, const trill_tx_params_t* params, 
+        const unsigned char* data, unsigned int data_len, unsigned int* id)
+{
+    tx_packet_t pkt;
+    BaseType_t ret;
+
+    if ((tx_task_handle == NULL) || stop_req)
+    {
+        return TRILL_ERR_INVALID_PARAMETERS;
+    }
+
+    if (data_len > sizeof(pkt.data))
+    {
+        return TRILL_ERR_DATALINK_PAYLOAD_TOO_LONG;
+    }
+
+    pkt.id = atomic_fetch_add(&next_id, 1);
+    pkt.mode = mode;
+    pkt.params = *params;
+    pkt.len = data_len;
+    memcpy(pkt.data, data, data_len);
+
+    // Before queueing, done callback may run right after.
+    if (id)
+        *id = pkt.id;
+
+    // Counted first, TX task may take the packet at once.
+    if (mode != TX_PKT_PREPARE)
+        atomic_fetch_add(&n_queued, 1);
+
+    if (mode == TX_PKT_REPLY)
+        ret = xQueueSendToFront(tx_packets, &pkt, 0);
+    else
+        ret = xQueueSend(tx_packets, &pkt, 0);
+
+    if (ret != pdTRUE)
+    {
+        if (mode != TX_PKT_PREPARE)
+            atomic_fetch_sub(&n_queued, 1);
+        printf("tx queue full\n");
+        return -1;
+    }
+
+    // TX task may be waiting for the channel on a queued packet.
+    if (mode == TX_PKT_REPLY)
+        lbt_abort = 1;
+
+    return 0;
+}
+
+int tx_queue_send(const trill_tx_params_t* params, 
+        const unsigned char* data, unsigned int data_len, unsigned int* id)
+{
+    return enqueue(TX_PKT_SEND, params, data, data_len, id);
+}
+
+int tx_queue_send_reply(const trill_tx_params_t* params, 
+        const unsigned char* data, unsigned int data_len, unsigned int* id)
+{
+    return enqueue(TX_PKT_REPLY, params, data, data_len, id);
+}
+
+int tx_queue_prepare(const trill_tx_params_t* params, 
+        const unsigned char* data, unsigned int data_len, unsigned int* id)
+{
+    return enqueue(TX_PKT_PREPARE, params, data, data_len, id);
+}
+
+unsigned int tx_queue_space(void)
+{
+    if ((tx_task_handle == NULL) || stop_req)
+        return 0;
+
+    return uxQueueSpacesAvailable(tx_packets);
+}
+
+void tx_queue_on_sent(void)
+{
+    if (tx_task_handle)
+        xTaskNotify(tx_task_handle, TX_NOTIFY_SENT, eSetBits);
+}
+
+int tx_queue_in_burst(void)
+{
+    return in_burst || atomic_load(&n_queued);
+}
+
+int tx_queue_on_air(void)
+{
+    return in_burst && !contending;
+}
+
+int tx_queue_preparing(void)
+{
+    return preparing;
+}
@@ -1,5 +1,6 @@
 #include <stdio.h>
 #include <time.h>
+#include <stdatomic.h>
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/timers.h"
@@ -10,6 +11,7 @@
 #include "esp_log.h"
 
 #include "ui.h"
+#include "rx_pool.h"
 #include "version.h"
 
 #define LIC_ERROR_MESSAGE \
@@ -31,12 +33,28 @@ static lv_obj_t* btn_start;
 static lv_obj_t* lbl_start_btn;
 static int allow_echo = 1;
 static echo_cb_t echo_cb;
+static echo_cb_t echo_long_cb;
+static int long_pressed;
 static start_cb_t start_cb;
 static int msg_count = 0;
+static lv_obj_t* lic_page;
 
 #define ECHO_BTN_MIN_WIDTH 80
 #define ECHO_BTN_MIN_HEIGHT 40
 
+/*
+    Events posted from SDK callbacks are coalesced and applied once
+    per UI loop iteration, only the latest state is drawn.
+    A newer RX buffer replaces a pending one which is released unseen.
+*/
+#define ECHO_REQ_NONE       (-1)
+
+static _Atomic(rx_buf_t*) rx_pending;
+static rx_buf_t* rx_shown;  // owned by UI loop
+static atomic_uint rx_posted;
+static unsigned int rx_applied;
+static atomic_int echo_req = ECHO_REQ_NONE;
+
 static void set_echo_button_ready(void);
 static void set_echo_button_busy(void);
 static void set_echo_button_disable(void);
@@ -45,8 +63,23 @@ static void echo_event_handler(lv_event_t * e)
 {
     lv_event_code_t code = lv_event_get_code(e);
 
-    if(code == LV_EVENT_CLICKED) {
+    if(code == LV_EVENT_PRESSED) {
+        long_pressed = 0;
+    }
+    else if(code == LV_EVENT_LONG_PRESSED) {
+        long_pressed = 1;
         if (allow_echo)
+        {
+            if (echo_long_cb)
+                if (echo_long_cb() >= 0)
+                {
+                    allow_echo = 0;
+                    set_echo_button_busy();
+                }
+        }
+    }
+    else if(code == LV_EVENT_CLICKED) {
+        if (allow_echo && !long_pressed)
         {
             if (echo_cb)
                 if (echo_cb() >= 0)
@@ -77,6 +110,11 @@ static void start_btn_event_handler(lv_event_t * e)
                 lv_label_set_text_static(lbl_status, "#ff0000 Listening...#");
                 lv_label_set_text_static(lbl_msg, "");
                 msg_count = 0;
+                if (rx_shown)
+                {
+                    rx_buf_release(rx_shown);
+                    rx_shown = NULL;
+                }
 
             }
             else //sdk stopped
@@ -104,6 +142,12 @@ int ui_set_echo_callback(echo_cb_t cb)
     return 0;
 }
 
+int ui_set_echo_long_callback(echo_cb_t cb)
+{
+    echo_long_cb = cb;
+    return 0;
+}
+
 static void set_echo_button_ready(void)
 {
     lv_label_set_text(lbl_echo_status, "Echo");
@@ -140,6 +184,17 @@ int ui_en_echo(int en)
 
 int ui_start(void)
 {
+    lv_obj_t* scr = lv_scr_act();
+
+    if (lic_page)
+    {
+        // License was provisioned at runtime, replace the error page.
+        scr = lv_obj_create(NULL);
+        lv_scr_load(scr);
+        lv_obj_del(lic_page);
+        lic_page = NULL;
+    }
+
     lv_style_init(&style_btn_busy);
     lv_style_set_bg_color(&style_btn_busy, lv_color_hex(0x0000FF));
     lv_style_set_min_width(&style_btn_busy, ECHO_BTN_MIN_WIDTH);
@@ -150,31 +205,31 @@ int ui_start(void)
     lv_style_set_min_width(&style_start_btn, ECHO_BTN_MIN_WIDTH);
     lv_style_set_min_height(&style_start_btn, ECHO_BTN_MIN_HEIGHT);
     
-    lv_obj_t *lab_title = lv_label_create(lv_scr_act());
+    lv_obj_t *lab_title = lv_label_create(scr);
     lv_label_set_text_static(lab_title, TITLE);
     lv_obj_set_style_text_font(lab_title, &lv_font_montserrat_24, LV_STATE_DEFAULT);
     lv_obj_align(lab_title, LV_ALIGN_TOP_MID, 0, 20);
 
 
-    lv_obj_t *lab_ver = lv_label_create(lv_scr_act());
+    lv_obj_t *lab_ver = lv_label_create(scr);
     lv_label_set_recolor(lab_ver, true);
     lv_label_set_text_fmt(lab_ver, "#969695 Version# #969695 %s#", APP_VERSION);
     lv_obj_set_style_text_font(lab_ver, &lv_font_montserrat_12, LV_STATE_DEFAULT);
     lv_obj_align_to(lab_ver, lab_title, LV_ALIGN_OUT_BOTTOM_MID, 0, 0);
 
-    lbl_status = lv_label_create(lv_scr_act());
+    lbl_status = lv_label_create(scr);
     lv_label_set_recolor(lbl_status, true);
     lv_label_set_text_static(lbl_status, "#ff0000 Listening...#");
     lv_obj_set_style_text_font(lbl_status, &lv_font_montserrat_18, LV_STATE_DEFAULT);
     lv_obj_align_to(lbl_status, lab_ver, LV_ALIGN_OUT_BOTTOM_MID, 0, 10);
 
-    lbl_msg = lv_label_create(lv_scr_act());
+    lbl_msg = lv_label_create(scr);
     lv_label_set_text_static(lbl_msg, "");
     lv_obj_set_style_text_font(lbl_msg, &lv_font_montserrat_18, LV_STATE_DEFAULT);
     lv_obj_align_to(lbl_msg, lbl_status, LV_ALIGN_OUT_BOTTOM_LEFT, -50, 10);
     lv_label_set_recolor(lbl_msg, true);
 
-    btn_echo = lv_btn_create(lv_scr_act());
+    btn_echo = lv_btn_create(scr);
     lv_obj_add_event_cb(btn_echo, echo_event_handler, LV_EVENT_ALL, btn_echo);
     lv_obj_align(btn_echo, LV_ALIGN_BOTTOM_MID, -50, -10);
     lv_obj_add_style(btn_echo, &style_btn_busy, LV_STATE_DEFAULT);
@@ -185,7 +240,7 @@ int ui_start(void)
     lv_obj_set_style_text_font(lbl_echo_status, &lv_font_montserrat_20, LV_STATE_DEFAULT);
     lv_obj_center(lbl_echo_status);
 
-    btn_start = lv_btn_create(lv_scr_act());
+    btn_start = lv_btn_create(scr);
     lv_obj_add_event_cb(btn_start, start_btn_event_handler, LV_EVENT_ALL, btn_start);
     lv_obj_align(btn_start, LV_ALIGN_BOTTOM_MID, 50, -10);
     lv_obj_add_style(btn_start, &style_start_btn, LV_STATE_DEFAULT);
@@ -200,17 +255,90 @@ int ui_start(void)
     return 0;
 }
 
-int ui_set_rx_msg(const char* txt)
+int ui_post_rx_buf(rx_buf_t* buf)
 {
-    lv_label_set_text_fmt(lbl_msg, "#0000ff %d) %s#", ++msg_count, txt);
+    atomic_fetch_add_explicit(&rx_posted, 1, memory_order_relaxed);
+
+    rx_buf_t* old = atomic_exchange_explicit(&rx_pending, buf, memory_order_acq_rel);
+    if (old)
+    {
+        rx_buf_release(old);
+    }
 
     return 0;
 }
 
+const rx_buf_t* ui_get_shown_rx_buf(void)
+{
+    return rx_shown;
+}
+
+int ui_post_en_echo(int en)
+{
+    atomic_store_explicit(&echo_req, en ? 1 : 0, memory_order_release);
+
+    return 0;
+}
+
+int ui_process_events(void)
+{
+    int echo = atomic_exchange_explicit(&echo_req, ECHO_REQ_NONE, 
+                memory_order_acquire);
+    if (echo != ECHO_REQ_NONE)
+    {
+        ui_en_echo(echo);
+    }
+
+    if (lbl_msg == NULL)
+    {
+        return 0;
+    }
+
+    rx_buf_t* buf = atomic_exchange_explicit(&rx_pending, NULL, memory_order_acq_rel);
+    if (buf == NULL)
+    {
+        return 0;
+    }
+
+    if (rx_shown)
+    {
+        rx_buf_release(rx_shown);
+    }
+    rx_shown = buf;
+
+    unsigned int posted = atomic_load_explicit(&rx_posted, memory_order_relaxed);
+    unsigned int n_new = posted - rx_applied;
+    rx_applied = posted;
+
+    if (n_new > 1)
+    {
+        printf("ui: %u rx messages coalesced\n", n_new - 1);
+    }
+
+    // show only ascii chars.
+    char txt[UI_MSG_MAX_LEN+1];
+    unsigned int i;
+    for (i = 0; i < buf->len; i++)
+    {
+        txt[i] = (buf->data[i] < 127) ? (char) buf->data[i] : '-';
+    }
+    txt[i] = '\0';
+
+    msg_count += n_new;
+    printf("ui: chn-%d, SSI%d, range %d, PLen: %u, SNR %.1f dB (sig %.1f, noise %.1f dBFS), rx msg %d) %s\n", 
+        buf->channel, buf->ssi, buf->data_cfg_range, buf->len, 
+        buf->metrics.snr_db, buf->metrics.signal_dbfs, buf->metrics.noise_dbfs,
+        msg_count, txt);
+    lv_label_set_text_fmt(lbl_msg, "#0000ff %d) %s#", msg_count, txt);
+
+    return 1;
+}
+
 int ui_lic_error(const char* dev_id)
 {
     lv_obj_t* page = lv_obj_create(NULL);
     lv_scr_load(page);
+    lic_page = page;
 
     lv_obj_t *lab_title = lv_label_create(page);
     lv_label_set_text_static(lab_title, TITLE);
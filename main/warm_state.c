@@ -0,0 +1,108 @@
+#include <stdio.h>
+#include <stdint.h>
+
+#include "nvs.h"
+
+#include "app_config.h"
+#include "listen.h"
+#include "beamform.h"
+#include "link_quality.h"
+#include "warm_state.h"
+
+#define WARM_NVS_NAMESPACE  "trill_app"
+#define WARM_NVS_KEY        "warm"
+#define WARM_VERSION        1
+
+typedef struct {
+    uint16_t version;
+    uint16_t size;
+    float listen_floor;
+    float beam_floor;
+    float beam_delay;
+    float link_noise;
+    float link_snr_db;
+    int8_t link_snr_valid;
+    int8_t link_tx_range;
+} warm_blob_t;
+
+int warm_state_load(void)
+{
+    nvs_handle_t h;
+    warm_blob_t st;
+    size_t len = sizeof(st);
+    link_quality_state_t lq;
+    esp_err_t err;
+
+    err = nvs_open(WARM_NVS_NAMESPACE, NVS_READONLY, &h);
+    if (err != ESP_OK)
+        return -1;
+
+    err = nvs_get_blob(h, WARM_NVS_KEY, &st, &len);
+    nvs_close(h);
+
+    if ((err != ESP_OK) || (len != sizeof(st)) ||
+        (st.version != WARM_VERSION) || (st.size != sizeof(st)))
+    {
+        printf("warm start: no state\n");
+        return -1;
+    }
+
+    listen_seed_floor(st.listen_floor);
+    beamform_seed(st.beam_floor, st.beam_delay);
+
+    lq.noise_energy = st.link_noise;
+    lq.snr_db = st.link_snr_db;
+    lq.snr_valid = st.link_snr_valid;
+    lq.tx_range = st.link_tx_range;
+    link_quality_seed(&lq);
+
+    printf("warm start: listen floor %.0f, beam floor %.0f delay %.2f, noise %.0f, snr %.1f dB (%d), range %d\n",
+        st.listen_floor, st.beam_floor, st.beam_delay, st.link_noise,
+        st.link_snr_db, st.link_snr_valid, st.link_tx_range);
+
+    return 0;
+}
+
+int warm_state_save(void)
+{
+    nvs_handle_t h;
+    warm_blob_t st = {0};
+    link_quality_state_t lq;
+    esp_err_t err;
+
+    link_quality_get_state(&lq);
+
+    st.version = WARM_VERSION;
+    st.size = sizeof(st);
+    st.listen_floor = listen_floor();
+    st.beam_floor = beamform_floor();
+    st.beam_delay = beamform_delay();
+    st.link_noise = lq.noise_energy;
+    st.link_snr_db = lq.snr_db;
+    st.link_snr_valid = lq.snr_valid;
+    st.link_tx_range = lq.tx_range;
+
+    // Nothing converged yet, keep what is stored.
+    if ((st.listen_floor == 0) && (st.beam_floor == 0) && (st.link_noise == 0))
+        return 0;
+
+    err = nvs_open(WARM_NVS_NAMESPACE, NVS_READWRITE, &h);
+    if (err != ESP_OK)
+    {
+        printf("warm state: nvs_open = %d\n", err);
+        return -1;
+    }
+
+    err = nvs_set_blob(h, WARM_NVS_KEY, &st, sizeof(st));
+    if (err == ESP_OK)
+        err = nvs_commit(h);
+    nvs_close(h);
+
+    if (err != ESP_OK)
+    {
+        printf("warm state: save = %d\n", err);
+        return -1;
+    }
+
+    return 0;
+}
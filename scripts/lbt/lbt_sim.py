@@ -0,0 +1,194 @@
+import argparse
+import os
+import random
+import re
+
+
+print()
+print("Trill listen before talk simulation v1.0")
+print()
+
+
+APP_CONFIG = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                          "..", "..", "main", "include", "app_config.h")
+
+# Used when app_config.h can not be read.
+DEFAULTS = {
+    "APP_LBT_IFS_MS": 150,
+    "APP_LBT_SLOT_MS": 50,
+    "APP_LBT_CW_MIN": 8,
+    "APP_LBT_CW_MAX": 128,
+    "APP_LBT_MAX_WAIT_MS": 30000,
+    "APP_TX_GUARD_MS": 50,
+}
+
+STEP_MS = 10
+
+
+def read_config(path):
+    cfg = dict(DEFAULTS)
+    try:
+        with open(path, "r") as f:
+            for line in f:
+                m = re.match(r"#define\s+(APP_\w+)\s+(\d+)\s*$", line)
+                if m and m.group(1) in cfg:
+                    cfg[m.group(1)] = int(m.group(2))
+    except OSError:
+        print("%s not found, using defaults" % path)
+    return cfg
+
+
+class Node:
+    def __init__(self):
+        self.queue = []         # arrival times of bursts waiting
+        self.state = "idle"
+        self.cw = 0
+        self.slots = 0
+        self.was_busy = False
+        self.contend_start = 0
+        self.pkt_left = 0       # packets left in current burst
+        self.tx_end = 0         # end of current packet or guard
+        self.on_air = None      # (start, end) of current packet
+        self.last_air = None    # last finished packet
+        self.next_arrival = 0
+
+
+def overlaps(a, lo, hi):
+    return a is not None and a[0] < hi and a[1] > lo
+
+
+def channel_busy(nodes, me, t, cfg, sense_ms):
+    # Activity heard sense_ms late, busy until IFS after it ended.
+    hi = t - sense_ms
+    lo = hi - cfg["APP_LBT_IFS_MS"]
+    for n in nodes:
+        if n is me:
+            continue
+        if overlaps(n.on_air, lo, hi + 1) or overlaps(n.last_air, lo, hi + 1):
+            return True
+    return False
+
+
+def run(n_nodes, lbt, cfg, args, seed):
+    # Same offered traffic with and without LBT.
+    arrivals = random.Random(seed)
+    rng = random.Random(seed + 1)
+    nodes = [Node() for _ in range(n_nodes)]
+    packets = []            # [start, end, node index]
+    delays = []
+    forced = 0
+    end_ms = int(args.duration * 1000)
+    airtime = int(args.airtime_ms)
+
+    for n in nodes:
+        n.next_arrival = arrivals.expovariate(1.0 / args.interval) * 1000
+
+    for t in range(0, end_ms, STEP_MS):
+        for n in nodes:
+            while n.next_arrival <= t:
+                n.queue.append(n.next_arrival)
+                n.next_arrival += arrivals.expovariate(1.0 / args.interval) * 1000
+
+        for i, n in enumerate(nodes):
+            if n.on_air is not None and t >= n.on_air[1]:
+                n.last_air = n.on_air
+                n.on_air = None
+
+            if n.state == "idle" and n.queue:
+                if lbt:
+                    n.state = "contend"
+                    n.cw = cfg["APP_LBT_CW_MIN"]
+                    n.slots = rng.randrange(n.cw)
+                    n.was_busy = False
+                    n.contend_start = t
+                    n.next_slot = t
+                else:
+                    n.state = "start"
+
+            if n.state == "contend" and t >= n.next_slot:
+                if t - n.contend_start >= cfg["APP_LBT_MAX_WAIT_MS"]:
+                    forced += 1
+                    n.state = "start"
+                elif channel_busy(nodes, n, t, cfg, args.sense_ms):
+                    if not n.was_busy:
+                        n.cw = min(n.cw * 2, cfg["APP_LBT_CW_MAX"])
+                        n.slots = rng.randrange(n.cw)
+                    n.was_busy = True
+                    n.next_slot = t + cfg["APP_LBT_SLOT_MS"]
+                else:
+                    n.was_busy = False
+                    if n.slots == 0:
+                        n.state = "start"
+                    else:
+                        n.slots -= 1
+                        n.next_slot = t + cfg["APP_LBT_SLOT_MS"]
+
+            if n.state == "start":
+                delays.append(t - n.queue.pop(0))
+                n.pkt_left = args.burst
+                n.state = "burst"
+                n.tx_end = t
+
+            if n.state == "burst" and t >= n.tx_end:
+                if n.pkt_left == 0:
+                    n.state = "idle"
+                    continue
+                n.pkt_left -= 1
+                n.on_air = (t, t + airtime)
+                packets.append([t, t + airtime, i])
+                n.tx_end = t + airtime + (cfg["APP_TX_GUARD_MS"] if n.pkt_left else 0)
+
+    # Every node hears every other, any overlap loses both packets.
+    packets = [p for p in packets if p[1] <= end_ms]
+    packets.sort()
+    lost = [False] * len(packets)
+    for a in range(len(packets)):
+        for b in range(a + 1, len(packets)):
+            if packets[b][0] >= packets[a][1]:
+                break
+            lost[a] = lost[b] = True
+
+    n_ok = lost.count(False)
+    return {
+        "sent": len(packets),
+        "collided": len(packets) - n_ok,
+        "goodput": n_ok * args.payload * 8 / args.duration,
+        "delay": (sum(delays) / len(delays) / 1000) if delays else 0,
+        "forced": forced,
+    }
+
+
+def main():
+    p = argparse.ArgumentParser(description="Nodes in one room sharing the acoustic channel.")
+    p.add_argument("--nodes", type=int, default=16, help="largest node count")
+    p.add_argument("--duration", type=float, default=3600, help="simulated seconds")
+    p.add_argument("--interval", type=float, default=60, help="mean seconds between bursts per node")
+    p.add_argument("--burst", type=int, default=1, help="packets per burst")
+    p.add_argument("--airtime-ms", type=float, default=2000, help="airtime of one packet")
+    p.add_argument("--payload", type=int, default=256, help="payload bytes per packet")
+    p.add_argument("--sense-ms", type=int, default=60, help="delay until a packet is detected")
+    p.add_argument("--seed", type=int, default=1)
+    p.add_argument("--config", default=APP_CONFIG, help="app_config.h to take APP_LBT_* from")
+    args = p.parse_args()
+
+    cfg = read_config(args.config)
+    print("ifs %d ms, slot %d ms, cw %d..%d, guard %d ms, airtime %d ms, sense %d ms" % (
+        cfg["APP_LBT_IFS_MS"], cfg["APP_LBT_SLOT_MS"], cfg["APP_LBT_CW_MIN"],
+        cfg["APP_LBT_CW_MAX"], cfg["APP_TX_GUARD_MS"], args.airtime_ms, args.sense_ms))
+    print()
+    print("%5s  %-5s %7s %9s %12s %9s %7s" % (
+        "nodes", "mode", "packets", "collided", "goodput bps", "delay s", "forced"))
+
+    n = 1
+    while n <= args.nodes:
+        for lbt in (False, True):
+            r = run(n, lbt, cfg, args, args.seed)
+            print("%5d  %-5s %7d %8.1f%% %12.1f %9.2f %7d" % (
+                n, "lbt" if lbt else "blind", r["sent"],
+                100.0 * r["collided"] / r["sent"] if r["sent"] else 0,
+                r["goodput"], r["delay"], r["forced"]))
+        n *= 2
+
+
+if __name__ == "__main__":
+    main()
@@ -10,6 +10,8 @@ RESPONSE_PREFIX = "tbr"
 COMMAND_PREFIX = "tbc "
 
 RESPONSE_TIMEOUT_SECS = 2
+# Device replies to license end once the license was applied.
+LICENSE_APPLY_TIMEOUT_SECS = 12
 MAX_ATTEMPTS = 3
 REPORT_ATTEMPT_ON_COUNT = 1
 
@@ -64,9 +66,9 @@ def send_string(sio, s):
     except:
         return False
 
-def _get_response_fields(sio):
+def _get_response_fields(sio, timeout=RESPONSE_TIMEOUT_SECS):
     start = time.time()
-    while (time.time() - start) < RESPONSE_TIMEOUT_SECS:
+    while (time.time() - start) < timeout:
         try:
             line = sio.readline()
             if not line.startswith(RESPONSE_PREFIX):
@@ -178,7 +180,7 @@ def _set_license_end(sio, chksum):
             #wait_for_prompt(sio)
         
         send_string(sio, cmd)
-        fields = _get_response_fields(sio)
+        fields = _get_response_fields(sio, LICENSE_APPLY_TIMEOUT_SECS)
         if not fields or len(fields) < 2:
             continue
         err_code = int(fields[1])
@@ -0,0 +1,114 @@
+import json
+import struct
+import sys
+
+
+print()
+print("Trill Trace to Chrome JSON v1.0")
+print()
+print("Args(2): <console log file> <output json file>")
+print()
+
+
+EVT_FORMAT = "<IHBB"
+EVT_SIZE = struct.calcsize(EVT_FORMAT)
+
+PH_BEGIN = 0
+PH_END = 1
+PH_INSTANT = 2
+
+
+def read_dumps(log_path):
+    # Returns one (id names, tracks, events) per TRACE_START..TRACE_STOP.
+    dumps = []
+    dump = None
+
+    with open(log_path, "r", errors="replace") as f:
+        for line in f:
+            line = line.strip()
+            # Console may prefix lines, keep from the marker on.
+            pos = line.find("TRACE_")
+            if pos < 0:
+                continue
+            fields = line[pos:].split()
+
+            if fields[0] == "TRACE_START":
+                dump = {"ids": {}, "events": [], "dropped": 0}
+                for kv in fields[2:]:
+                    if kv.startswith("dropped="):
+                        dump["dropped"] = int(kv.split("=")[1])
+            elif dump is None:
+                continue
+            elif fields[0] == "TRACE_ID" and len(fields) == 4:
+                dump["ids"][int(fields[1])] = (fields[2], fields[3])
+            elif fields[0] == "TRACE_DATA" and len(fields) == 2:
+                data = bytes.fromhex(fields[1])
+                for off in range(0, len(data) - EVT_SIZE + 1, EVT_SIZE):
+                    ts_lo, ts_hi, evt_id, info = struct.unpack_from(EVT_FORMAT, data, off)
+                    dump["events"].append(((ts_hi << 32) | ts_lo, evt_id, info & 0x03, info >> 2))
+            elif fields[0] == "TRACE_STOP":
+                dumps.append(dump)
+                dump = None
+
+    return dumps
+
+
+def to_chrome(dumps):
+    out = []
+    tids = {}
+
+    for dump in dumps:
+        ids = dump["ids"]
+        events = sorted(dump["events"], key=lambda e: e[0])
+        # Open spans per (core, track), ends may rename the span.
+        stacks = {}
+
+        for ts, evt_id, ph, core in events:
+            track, name = ids.get(evt_id, ("unknown", "id_%d" % evt_id))
+            tid = tids.setdefault(track, len(tids) + 1)
+            key = (core, track)
+
+            if ph == PH_BEGIN:
+                stacks.setdefault(key, []).append((ts, name))
+            elif ph == PH_END:
+                stack = stacks.get(key)
+                if not stack:
+                    # Begin was overwritten in the ring.
+                    continue
+                begin_ts, begin_name = stack.pop()
+                args = {}
+                if name != begin_name:
+                    args["call"] = begin_name
+                out.append({"name": name, "ph": "X", "ts": begin_ts, "dur": ts - begin_ts,
+                            "pid": core, "tid": tid, "args": args})
+            elif ph == PH_INSTANT:
+                out.append({"name": name, "ph": "i", "s": "t", "ts": ts,
+                            "pid": core, "tid": tid})
+
+        if dump["dropped"]:
+            print("Warning :: %d events were overwritten in the ring." % dump["dropped"])
+
+    for core in sorted(set(e["pid"] for e in out)):
+        out.append({"name": "process_name", "ph": "M", "pid": core,
+                    "args": {"name": "core %d" % core}})
+        for track, tid in tids.items():
+            out.append({"name": "thread_name", "ph": "M", "pid": core, "tid": tid,
+                        "args": {"name": track}})
+
+    return {"traceEvents": out, "displayTimeUnit": "ms"}
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 3:
+        sys.exit(-1)
+
+    dumps = read_dumps(sys.argv[1])
+    if not dumps:
+        print("Error :: no TRACE_START..TRACE_STOP dump found in log.")
+        sys.exit(-1)
+
+    with open(sys.argv[2], "w") as f:
+        json.dump(to_chrome(dumps), f)
+
+    print("Wrote %d dump(s) to %s, open it in chrome://tracing or ui.perfetto.dev" %
+          (len(dumps), sys.argv[2]))
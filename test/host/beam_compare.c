@@ -0,0 +1,264 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+
+#include "app_config.h"
+
+/*
+    Q15 against float path of main/beamform.c, both built from the same
+    source (beam_node_q15.c, beam_node_f32.c).
+
+    Corpus: per case a random delay of mic 1 within +-9 samples and one
+    of a few SNRs. Mic signals are a 15..21 kHz chirp evaluated at the
+    exact delayed time plus independent Gaussian noise. Each path gets
+    quiet blocks to learn the gate level, then preamble blocks, and its
+    steering delay is compared with the other path and with the truth.
+
+    Output: both paths seeded with the same delay (a multiple of the Q15
+    path's 1/256 sample step) and frozen, fed the same blocks, beam
+    samples compared.
+
+    At 3..6 dB both paths sometimes lock onto the same correlation
+    sidelobe about 2.65 samples off; that is the estimator, not Q15, and
+    is counted but not failed. A split (paths further apart than
+    TOL_PATHS) is a Q15 difference and may occur in at most 1 of
+    MAX_SPLIT_PER cases, as near-equal peaks can go either way.
+
+    Tolerances below are what this corpus gives, not a bound.
+*/
+
+#define N_SAMPLES       1024
+#define N_CHANNELS      2
+#define FS              48000.0
+#define CHIRP_F0        15000.0
+#define CHIRP_F1        21000.0
+#define AMPLITUDE       8000.0
+#define MAX_TRUE_DELAY  9.0
+#define QUIET_BLOCKS    8
+#define PREAMBLE_BLOCKS 4
+
+#define TOL_PATHS       0.05    // samples, Q15 vs float steering
+#define TOL_TRUTH       0.25    // samples, either path vs true delay
+#define TOL_LSB         2       // beam output, same delay
+#define MAX_SPLIT_PER   500
+
+#define DECLARE_PATH(p) \
+    int p##_beamform_init(unsigned int n_samples); \
+    void p##_beamform_deinit(void); \
+    void p##_beamform_process(int16_t* block, unsigned int n_samples, \
+            unsigned int n_channels, int demod_active); \
+    float p##_beamform_delay(void); \
+    void p##_beamform_set_load(int level); \
+    void p##_beamform_seed(float floor, float delay);
+
+DECLARE_PATH(q15)
+DECLARE_PATH(f32)
+
+typedef struct {
+    const char* name;
+    int (*init)(unsigned int n_samples);
+    void (*deinit)(void);
+    void (*process)(int16_t* block, unsigned int n_samples,
+            unsigned int n_channels, int demod_active);
+    float (*delay)(void);
+    void (*set_load)(int level);
+    void (*seed)(float floor, float delay);
+} path_t;
+
+static const path_t paths[2] = {
+    {"q15", q15_beamform_init, q15_beamform_deinit, q15_beamform_process,
+        q15_beamform_delay, q15_beamform_set_load, q15_beamform_seed},
+    {"f32", f32_beamform_init, f32_beamform_deinit, f32_beamform_process,
+        f32_beamform_delay, f32_beamform_set_load, f32_beamform_seed},
+};
+
+static const double snr_db[] = {20.0, 12.0, 6.0, 3.0};
+
+static int verbose;
+
+static double gauss(void)
+{
+    double u1 = (random() + 1.0) / (RAND_MAX + 2.0);
+    double u2 = (random() + 1.0) / (RAND_MAX + 2.0);
+
+    return sqrt(-2.0 * log(u1)) * cos(2.0 * M_PI * u2);
+}
+
+static double chirp(double t)
+{
+    const double len = N_SAMPLES / FS;
+    double tm = fmod(t, len);
+
+    if (tm < 0)
+        tm += len;
+
+    return sin(2.0 * M_PI * (CHIRP_F0 * tm + 0.5 * (CHIRP_F1 - CHIRP_F0) / len * tm * tm));
+}
+
+static int16_t clip(double v)
+{
+    if (v > 32767.0)
+        return 32767;
+    if (v < -32768.0)
+        return -32768;
+    return (int16_t) lrint(v);
+}
+
+/* Block b of a case, mic 1 hears the wavefront delay samples after mic 0. */
+static void make_block(int16_t* block, int b, double delay, double amp, double noise)
+{
+    for (int n = 0; n < N_SAMPLES; n++)
+    {
+        double t = (b * N_SAMPLES + n) / FS;
+
+        block[N_CHANNELS * n] = clip(amp * chirp(t) + noise * gauss());
+        block[N_CHANNELS * n + 1] = clip(amp * chirp(t - delay / FS) + noise * gauss());
+    }
+}
+
+static void run_case(double delay, double snr, float out[2])
+{
+    static int16_t block[2][N_SAMPLES * N_CHANNELS];
+    double noise = AMPLITUDE / sqrt(2.0) / pow(10.0, snr / 20.0);
+
+    for (int p = 0; p < 2; p++)
+    {
+        paths[p].seed(0, 0);
+        paths[p].set_load(0);
+        paths[p].init(N_SAMPLES);
+    }
+
+    for (int b = 0; b < QUIET_BLOCKS + PREAMBLE_BLOCKS; b++)
+    {
+        make_block(block[0], b, delay, (b < QUIET_BLOCKS) ? 0 : AMPLITUDE, noise);
+        memcpy(block[1], block[0], sizeof(block[0]));
+
+        for (int p = 0; p < 2; p++)
+            paths[p].process(block[p], N_SAMPLES, N_CHANNELS, 0);
+    }
+
+    for (int p = 0; p < 2; p++)
+    {
+        out[p] = paths[p].delay();
+        paths[p].deinit();
+    }
+}
+
+/* Largest beam sample difference with both paths steered to delay. */
+static int compare_output(double delay, double snr)
+{
+    static int16_t block[2][N_SAMPLES * N_CHANNELS];
+    double noise = AMPLITUDE / sqrt(2.0) / pow(10.0, snr / 20.0);
+    int max_diff = 0;
+
+    for (int p = 0; p < 2; p++)
+    {
+        paths[p].seed(0, (float) delay);
+        paths[p].init(N_SAMPLES);
+        paths[p].set_load(2);
+    }
+
+    for (int b = 0; b < 3; b++)
+    {
+        make_block(block[0], b, delay, AMPLITUDE, noise);
+        memcpy(block[1], block[0], sizeof(block[0]));
+
+        for (int p = 0; p < 2; p++)
+            paths[p].process(block[p], N_SAMPLES, N_CHANNELS, 0);
+
+        // First block runs on empty history.
+        for (int n = (b == 0) ? 16 : 0; n < N_SAMPLES; n++)
+        {
+            int d = abs(block[0][N_CHANNELS * n] - block[1][N_CHANNELS * n]);
+
+            if (d > max_diff)
+                max_diff = d;
+        }
+    }
+
+    for (int p = 0; p < 2; p++)
+        paths[p].deinit();
+
+    return max_diff;
+}
+
+int main(int argc, char** argv)
+{
+    unsigned int n_cases = 60;
+    unsigned int seed = 1;
+    unsigned int n_split = 0, n_sidelobe = 0;
+    int fail;
+    double max_paths = 0, max_truth[2] = {0, 0}, sum_paths = 0;
+    int max_lsb = 0;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "n:s:vh")) != -1)
+    {
+        switch (opt)
+        {
+            case 'n': n_cases = strtoul(optarg, NULL, 10); break;
+            case 's': seed = strtoul(optarg, NULL, 10); break;
+            case 'v': verbose = 1; break;
+            default:
+                printf("usage: %s [-n cases] [-s seed] [-v]\n"
+                       "  -n  corpus cases, default 60\n"
+                       "  -s  random seed, default 1\n"
+                       "  -v  print every case\n", argv[0]);
+                return 2;
+        }
+    }
+
+    srandom(seed);
+
+    for (unsigned int c = 0; c < n_cases; c++)
+    {
+        double delay = MAX_TRUE_DELAY * (2.0 * random() / RAND_MAX - 1.0);
+        double snr = snr_db[c % (sizeof(snr_db) / sizeof(snr_db[0]))];
+        float d[2];
+        double e_paths;
+        int lsb;
+
+        run_case(delay, snr, d);
+
+        // Same delay in both paths, on the Q15 1/256 sample grid.
+        lsb = compare_output(round(delay * 256.0) / 256.0, snr);
+
+        e_paths = fabs(d[0] - d[1]);
+        sum_paths += e_paths;
+        if (e_paths > max_paths)
+            max_paths = e_paths;
+        if (lsb > max_lsb)
+            max_lsb = lsb;
+
+        for (int p = 0; p < 2; p++)
+        {
+            if (fabs(d[p] - delay) > max_truth[p])
+                max_truth[p] = fabs(d[p] - delay);
+        }
+
+        if (e_paths > TOL_PATHS)
+            n_split++;
+        else if (fabs(d[0] - delay) > TOL_TRUTH)
+            n_sidelobe++;
+
+        if (verbose || (e_paths > TOL_PATHS) || (lsb > TOL_LSB) ||
+            (fabs(d[0] - delay) > TOL_TRUTH))
+        {
+            printf("case %2u: true %+7.3f snr %4.1f dB | q15 %+7.3f f32 %+7.3f | out diff %d LSB\n",
+                c, delay, snr, d[0], d[1], lsb);
+        }
+    }
+
+    fail = (n_split * MAX_SPLIT_PER > n_cases) || (max_lsb > TOL_LSB);
+
+    printf("beam: %u cases, q15 vs f32 delay max %.3f mean %.3f samples, "
+           "vs truth max q15 %.3f f32 %.3f, output max %d LSB\n",
+        n_cases, max_paths, n_cases ? sum_paths / n_cases : 0.0,
+        max_truth[0], max_truth[1], max_lsb);
+    printf("beam: %u splits, %u shared sidelobe locks\n", n_split, n_sidelobe);
+
+    printf("%s\n", fail ? "FAIL" : "PASS");
+    return fail ? 1 : 0;
+}
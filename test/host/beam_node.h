@@ -0,0 +1,25 @@
+#ifndef _BEAM_NODE_H_
+#define _BEAM_NODE_H_
+
+/*
+    Builds main/beamform.c once per arithmetic path. BEAM_NODE prefixes
+    the external symbols, module statics are private to each
+    translation unit, so both paths link into one test.
+*/
+
+#include <stdio.h>
+
+#include "app_config.h"
+
+#define BEAM_CAT_(n, s)         n##_##s
+#define BEAM_CAT(n, s)          BEAM_CAT_(n, s)
+
+#define beamform_init           BEAM_CAT(BEAM_NODE, beamform_init)
+#define beamform_deinit         BEAM_CAT(BEAM_NODE, beamform_deinit)
+#define beamform_process        BEAM_CAT(BEAM_NODE, beamform_process)
+#define beamform_delay          BEAM_CAT(BEAM_NODE, beamform_delay)
+#define beamform_floor          BEAM_CAT(BEAM_NODE, beamform_floor)
+#define beamform_set_load       BEAM_CAT(BEAM_NODE, beamform_set_load)
+#define beamform_seed           BEAM_CAT(BEAM_NODE, beamform_seed)
+
+#endif //_BEAM_NODE_H_
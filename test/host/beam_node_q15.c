@@ -0,0 +1,7 @@
+#define BEAM_NODE               q15
+#include "beam_node.h"
+
+#undef APP_BEAM_Q15
+#define APP_BEAM_Q15            1
+
+#include "../../main/beamform.c"
@@ -0,0 +1,157 @@
+#!/usr/bin/env python3
+"""
+Writes rfc8439_vectors.h for rfc8439_test.c.
+
+ChaCha20-Poly1305 AEAD straight from the RFC 8439 text, with Python
+integers for Poly1305. Checked against the RFC's own vectors (2.8.2 and
+A.5) before any vector is written. Lengths cover 0, block edges of both
+ChaCha20 (64) and Poly1305 (16), the largest Trill payload and beyond.
+"""
+
+import random
+import struct
+import sys
+
+MASK32 = 0xffffffff
+
+
+def rotl(v, n):
+    return ((v << n) | (v >> (32 - n))) & MASK32
+
+
+def quarter(s, a, b, c, d):
+    s[a] = (s[a] + s[b]) & MASK32; s[d] = rotl(s[d] ^ s[a], 16)
+    s[c] = (s[c] + s[d]) & MASK32; s[b] = rotl(s[b] ^ s[c], 12)
+    s[a] = (s[a] + s[b]) & MASK32; s[d] = rotl(s[d] ^ s[a], 8)
+    s[c] = (s[c] + s[d]) & MASK32; s[b] = rotl(s[b] ^ s[c], 7)
+
+
+def chacha20_block(key, counter, nonce):
+    state = [0x61707865, 0x3320646e, 0x79622d32, 0x6b206574]
+    state += list(struct.unpack('<8I', key))
+    state += [counter]
+    state += list(struct.unpack('<3I', nonce))
+    s = list(state)
+    for _ in range(10):
+        quarter(s, 0, 4, 8, 12); quarter(s, 1, 5, 9, 13)
+        quarter(s, 2, 6, 10, 14); quarter(s, 3, 7, 11, 15)
+        quarter(s, 0, 5, 10, 15); quarter(s, 1, 6, 11, 12)
+        quarter(s, 2, 7, 8, 13); quarter(s, 3, 4, 9, 14)
+    return struct.pack('<16I', *[(x + y) & MASK32 for x, y in zip(s, state)])
+
+
+def chacha20_encrypt(key, counter, nonce, data):
+    out = bytearray()
+    for i in range(0, len(data), 64):
+        ks = chacha20_block(key, counter + i // 64, nonce)
+        out += bytes(a ^ b for a, b in zip(data[i:i + 64], ks))
+    return bytes(out)
+
+
+def poly1305(key, msg):
+    r = int.from_bytes(key[:16], 'little') & 0x0ffffffc0ffffffc0ffffffc0fffffff
+    s = int.from_bytes(key[16:], 'little')
+    p = (1 << 130) - 5
+    acc = 0
+    for i in range(0, len(msg), 16):
+        n = int.from_bytes(msg[i:i + 16] + b'\x01', 'little')
+        acc = ((acc + n) * r) % p
+    return ((acc + s) & ((1 << 128) - 1)).to_bytes(16, 'little')
+
+
+def pad16(b):
+    return b'\x00' * (-len(b) % 16)
+
+
+def aead_encrypt(key, nonce, ad, plain):
+    otk = chacha20_block(key, 0, nonce)[:32]
+    cipher = chacha20_encrypt(key, 1, nonce, plain)
+    mac = ad + pad16(ad) + cipher + pad16(cipher)
+    mac += struct.pack('<QQ', len(ad), len(cipher))
+    return cipher + poly1305(otk, mac)
+
+
+def self_check():
+    # RFC 8439 2.8.2
+    plain = (b"Ladies and Gentlemen of the class of '99: If I could offer you "
+             b"only one tip for the future, sunscreen would be it.")
+    key = bytes(range(0x80, 0xa0))
+    nonce = bytes.fromhex('070000004041424344454647')
+    ad = bytes.fromhex('50515253c0c1c2c3c4c5c6c7')
+    out = aead_encrypt(key, nonce, ad, plain)
+    assert out[-16:].hex() == '1ae10b594f09e26a7e902ecbd0600691'
+    assert out[:16].hex() == 'd31a8d34648e60db7b86afbc53ef7ec2'
+
+    # RFC 8439 A.5, 265 bytes, decrypted by re-encrypting the plain text.
+    key = bytes.fromhex('1c9240a5eb55d38af333888604f6b5f0'
+                        '473917c1402b80099dca5cbc207075c0')
+    nonce = bytes.fromhex('000000000102030405060708')
+    ad = bytes.fromhex('f33388860000000000004e91')
+    plain = (b'Internet-Drafts are draft documents valid for a maximum of six '
+             b'months and may be updated, replaced, or obsoleted by other '
+             b'documents at any time. It is inappropriate to use Internet-'
+             b'Drafts as reference material or to cite them other than as '
+             b'/\xe2\x80\x9cwork in progress./\xe2\x80\x9d')
+    out = aead_encrypt(key, nonce, ad, plain)
+    assert len(plain) == 265
+    assert out[:16].hex() == '64a0861575861af460f062c79be643bd'
+    assert out[-16:].hex() == 'eead9d67890cbb22392336fea1851f38'
+
+
+def c_bytes(b, indent='    '):
+    if not b:
+        return indent + '0'
+    lines = []
+    for i in range(0, len(b), 12):
+        lines.append(indent + ', '.join('0x%02x' % x for x in b[i:i + 12]))
+    return ',\n'.join(lines)
+
+
+def main():
+    self_check()
+
+    rnd = random.Random(8439)
+    lengths = [0, 1, 15, 16, 17, 63, 64, 65, 127, 128, 129, 191, 250, 255,
+               256, 257, 300, 1000]
+    ad_lengths = [0, 1, 12, 16, 17]
+
+    out = ['/* Generated by gen_rfc8439_vectors.py, do not edit. */', '',
+           'typedef struct {',
+           '    uint8_t key[32];',
+           '    uint8_t nonce[12];',
+           '    size_t ad_len;',
+           '    const uint8_t* ad;',
+           '    size_t len;',
+           '    const uint8_t* plain;',
+           '    const uint8_t* cipher;      // len + tag',
+           '} rfc8439_vector_t;', '']
+    entries = []
+
+    for i, n in enumerate(lengths):
+        key = bytes(rnd.getrandbits(8) for _ in range(32))
+        nonce = bytes(rnd.getrandbits(8) for _ in range(12))
+        ad = bytes(rnd.getrandbits(8) for _ in range(ad_lengths[i % len(ad_lengths)]))
+        plain = bytes(rnd.getrandbits(8) for _ in range(n))
+        cipher = aead_encrypt(key, nonce, ad, plain)
+
+        out.append('static const uint8_t v%d_ad[] = {\n%s\n};' % (i, c_bytes(ad)))
+        out.append('static const uint8_t v%d_plain[] = {\n%s\n};' % (i, c_bytes(plain)))
+        out.append('static const uint8_t v%d_cipher[] = {\n%s\n};' % (i, c_bytes(cipher)))
+        out.append('')
+        entries.append('    {\n        {\n%s\n        },\n        {\n%s\n        },\n'
+                       '        %d, v%d_ad, %d, v%d_plain, v%d_cipher\n    },'
+                       % (c_bytes(key, ' ' * 12), c_bytes(nonce, ' ' * 12),
+                          len(ad), i, n, i, i))
+
+    out.append('static const rfc8439_vector_t rfc8439_vectors[] = {')
+    out += entries
+    out.append('};')
+
+    with open('rfc8439_vectors.h', 'w') as f:
+        f.write('\n'.join(out) + '\n')
+
+    print('%d vectors written' % len(lengths))
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,217 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "esp_dsp.h"
+
+#include "rfc8439.h"
+#include "rfc8439_vectors.h"
+
+/*
+    Host check of main/rfc8439.c, which replaces the SDK's AEAD and so
+    also the license verification.
+
+    Every vector of rfc8439_vectors.h (lengths 0..1000, generated from an
+    independent implementation checked against RFC 8439 2.8.2 and A.5)
+    is encrypted and decrypted at each of 4 buffer alignments, with
+    guard bytes around the output. A flipped bit in cipher text, tag or
+    associated data must be rejected without touching the output.
+    rfc8439_self_test() runs as on the target.
+
+    Benchmark: host time stamp counter per byte for a few payload sizes.
+    Numbers compare builds on one machine, they are not LX7 cycles,
+    APP_CRYPTO_SELF_TEST prints those on the board.
+*/
+
+#define N_VECTORS       (sizeof(rfc8439_vectors) / sizeof(rfc8439_vectors[0]))
+#define MAX_LEN         1024
+#define GUARD           16
+#define GUARD_BYTE      0xcd
+
+static uint8_t out_buf[GUARD + 3 + MAX_LEN + RFC_8439_TAG_SIZE + GUARD];
+static uint8_t in_buf[3 + MAX_LEN + RFC_8439_TAG_SIZE];
+
+static int guards_intact(const uint8_t* out, size_t len)
+{
+    for (const uint8_t* p = out_buf; p < out; p++)
+        if (*p != GUARD_BYTE)
+            return 0;
+
+    for (const uint8_t* p = out + len; p < out_buf + sizeof(out_buf); p++)
+        if (*p != GUARD_BYTE)
+            return 0;
+
+    return 1;
+}
+
+static int check_vector(unsigned int idx, const rfc8439_vector_t* v, unsigned int align)
+{
+    uint8_t* out = &out_buf[GUARD + align];
+    uint8_t* in = &in_buf[align];
+    size_t cipher_len = v->len + RFC_8439_TAG_SIZE;
+    size_t n;
+
+    // Encrypt
+    memset(out_buf, GUARD_BYTE, sizeof(out_buf));
+    memcpy(in, v->plain, v->len);
+    n = portable_chacha20_poly1305_encrypt(out, v->key, v->nonce,
+        v->ad, v->ad_len, in, v->len);
+
+    if ((n != cipher_len) || memcmp(out, v->cipher, cipher_len) || !guards_intact(out, n))
+    {
+        printf("vector %u (%zu bytes, ad %zu, align %u): encrypt mismatch\n",
+            idx, v->len, v->ad_len, align);
+        return -1;
+    }
+
+    // Decrypt
+    memset(out_buf, GUARD_BYTE, sizeof(out_buf));
+    memcpy(in, v->cipher, cipher_len);
+    n = portable_chacha20_poly1305_decrypt(out, v->key, v->nonce,
+        v->ad, v->ad_len, in, cipher_len);
+
+    if ((n != v->len) || memcmp(out, v->plain, v->len) || !guards_intact(out, n))
+    {
+        printf("vector %u (%zu bytes, ad %zu, align %u): decrypt mismatch\n",
+            idx, v->len, v->ad_len, align);
+        return -1;
+    }
+
+    // Forgeries: first and last cipher text byte, tag, associated data.
+    for (int what = 0; what < 4; what++)
+    {
+        uint8_t ad[32];
+
+        memcpy(in, v->cipher, cipher_len);
+        memcpy(ad, v->ad, v->ad_len);
+
+        if ((what < 2) && (v->len == 0))
+            continue;
+        if ((what == 3) && (v->ad_len == 0))
+            continue;
+
+        if (what == 0)
+            in[0] ^= 0x01;
+        else if (what == 1)
+            in[v->len - 1] ^= 0x80;
+        else if (what == 2)
+            in[v->len + (idx % RFC_8439_TAG_SIZE)] ^= 0x10;
+        else
+            ad[v->ad_len - 1] ^= 0x01;
+
+        memset(out_buf, GUARD_BYTE, sizeof(out_buf));
+        n = portable_chacha20_poly1305_decrypt(out, v->key, v->nonce,
+            ad, v->ad_len, in, cipher_len);
+
+        // Nothing is written before the tag was checked.
+        if ((n != RFC_8439_FAIL) || !guards_intact(out, 0))
+        {
+            printf("vector %u (%zu bytes, align %u): forgery %d accepted or output written\n",
+                idx, v->len, align, what);
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+static int check_short_input(void)
+{
+    const rfc8439_vector_t* v = &rfc8439_vectors[0];
+
+    // Shorter than a tag, nothing to authenticate.
+    for (size_t len = 0; len < RFC_8439_TAG_SIZE; len++)
+    {
+        if (portable_chacha20_poly1305_decrypt(out_buf, v->key, v->nonce,
+                NULL, 0, v->cipher, len) != RFC_8439_FAIL)
+        {
+            printf("%zu byte cipher text accepted\n", len);
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+static void bench(unsigned int iters)
+{
+    static const size_t sizes[] = {16, 64, 256, 1024};
+    const rfc8439_vector_t* v = &rfc8439_vectors[0];
+    uint8_t ad[12] = {0};
+
+    printf("  bytes   enc ts/byte   dec ts/byte\n");
+
+    for (unsigned int i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+    {
+        size_t len = sizes[i];
+        uint64_t t0, enc, dec;
+
+        memset(in_buf, 0xa5, len);
+
+        t0 = host_cycle_count();
+        for (unsigned int k = 0; k < iters; k++)
+        {
+            portable_chacha20_poly1305_encrypt(out_buf, v->key, v->nonce,
+                ad, sizeof(ad), in_buf, len);
+        }
+        enc = host_cycle_count() - t0;
+
+        memcpy(in_buf, out_buf, len + RFC_8439_TAG_SIZE);
+
+        t0 = host_cycle_count();
+        for (unsigned int k = 0; k < iters; k++)
+        {
+            portable_chacha20_poly1305_decrypt(out_buf, v->key, v->nonce,
+                ad, sizeof(ad), in_buf, len + RFC_8439_TAG_SIZE);
+        }
+        dec = host_cycle_count() - t0;
+
+        printf("  %5zu   %11.1f   %11.1f\n", len,
+            (double) enc / ((double) iters * len),
+            (double) dec / ((double) iters * len));
+    }
+}
+
+int main(int argc, char** argv)
+{
+    unsigned int iters = 20000;
+    unsigned int n_fail = 0;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "i:h")) != -1)
+    {
+        switch (opt)
+        {
+            case 'i': iters = strtoul(optarg, NULL, 10); break;
+            default:
+                printf("usage: %s [-i iterations]\n"
+                       "  -i  benchmark iterations per size, 0 skips, default 20000\n",
+                    argv[0]);
+                return 2;
+        }
+    }
+
+    for (unsigned int i = 0; i < N_VECTORS; i++)
+    {
+        for (unsigned int align = 0; align < 4; align++)
+        {
+            if (check_vector(i, &rfc8439_vectors[i], align) < 0)
+                n_fail++;
+        }
+    }
+
+    if (check_short_input() < 0)
+        n_fail++;
+
+    if (rfc8439_self_test() < 0)
+        n_fail++;
+
+    printf("rfc8439: %zu vectors x 4 alignments, %u failures\n", N_VECTORS, n_fail);
+
+    if (iters)
+        bench(iters);
+
+    printf("%s\n", n_fail ? "FAIL" : "PASS");
+    return n_fail ? 1 : 0;
+}
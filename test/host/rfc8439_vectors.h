@@ -0,0 +1,926 @@
+/* Generated by gen_rfc8439_vectors.py, do not edit. */
+
+typedef struct {
+    uint8_t key[32];
+    uint8_t nonce[12];
+    size_t ad_len;
+    const uint8_t* ad;
+    size_t len;
+    const uint8_t* plain;
+    const uint8_t* cipher;      // len + tag
+} rfc8439_vector_t;
+
+static const uint8_t v0_ad[] = {
+    0
+};
+static const uint8_t v0_plain[] = {
+    0
+};
+static const uint8_t v0_cipher[] = {
+    0x4c, 0x4e, 0xd9, 0x48, 0xd9, 0x8b, 0xd3, 0x37, 0xf2, 0xe5, 0x71, 0x09,
+    0x87, 0x3c, 0x15, 0xe0
+};
+
+static const uint8_t v1_ad[] = {
+    0x84
+};
+static const uint8_t v1_plain[] = {
+    0xf8
+};
+static const uint8_t v1_cipher[] = {
+    0xa6, 0xc6, 0xd1, 0xa7, 0x70, 0x4d, 0xd6, 0x37, 0x1f, 0xf5, 0xab, 0xa3,
+    0x34, 0x16, 0x36, 0x16, 0x0e
+};
+
+static const uint8_t v2_ad[] = {
+    0x1d, 0x82, 0xfc, 0x66, 0x25, 0xe0, 0x95, 0xff, 0x26, 0xc8, 0xaa, 0xb0
+};
+static const uint8_t v2_plain[] = {
+    0xf9, 0x1d, 0x86, 0x3c, 0x37, 0x89, 0xeb, 0x7d, 0x61, 0x29, 0xde, 0x6b,
+    0xb9, 0xe5, 0x6d
+};
+static const uint8_t v2_cipher[] = {
+    0x08, 0xd7, 0x05, 0xfb, 0xb8, 0x58, 0x3d, 0x61, 0xda, 0x69, 0xc5, 0xa4,
+    0xd9, 0x97, 0x2a, 0x86, 0xb7, 0x2d, 0x3c, 0xc4, 0xc8, 0xa2, 0x9c, 0x2a,
+    0x61, 0xa1, 0x58, 0xed, 0x89, 0x42, 0x00
+};
+
+static const uint8_t v3_ad[] = {
+    0xc9, 0x2b, 0x22, 0x71, 0xbd, 0x5a, 0x2d, 0x8e, 0x63, 0xff, 0xa7, 0xc9,
+    0x1a, 0x4c, 0x1b, 0xdb
+};
+static const uint8_t v3_plain[] = {
+    0xb2, 0xa7, 0xf5, 0xc5, 0x70, 0x95, 0xa8, 0x04, 0x58, 0xd4, 0x5b, 0xbe,
+    0xd6, 0xac, 0x5d, 0x29
+};
+static const uint8_t v3_cipher[] = {
+    0x2e, 0xdc, 0x30, 0xb6, 0x71, 0xb1, 0xc8, 0x9d, 0x95, 0xfd, 0x7c, 0x20,
+    0x06, 0x75, 0x75, 0x15, 0x78, 0x45, 0xf6, 0x2a, 0xb1, 0x51, 0xfe, 0x84,
+    0x1b, 0x10, 0x20, 0xda, 0x90, 0xdb, 0x80, 0xb4
+};
+
+static const uint8_t v4_ad[] = {
+    0x96, 0x9f, 0x7f, 0xf9, 0xef, 0xe6, 0xff, 0x9b, 0x46, 0x8d, 0xac, 0xa2,
+    0xe9, 0xf2, 0xdf, 0x94, 0x3f
+};
+static const uint8_t v4_plain[] = {
+    0x4a, 0x30, 0x3e, 0x23, 0x66, 0xf8, 0xc6, 0xb9, 0x20, 0x22, 0xe7, 0xf1,
+    0x73, 0x6b, 0x38, 0x24, 0xe4
+};
+static const uint8_t v4_cipher[] = {
+    0xa2, 0x98, 0x66, 0x59, 0x09, 0xde, 0xc6, 0xcc, 0xef, 0xde, 0xb7, 0x37,
+    0xfa, 0x7c, 0xf7, 0xd0, 0xb0, 0xe2, 0xc0, 0x07, 0xfe, 0xcc, 0xad, 0xef,
+    0x85, 0xf7, 0x9f, 0xa7, 0xb8, 0x4d, 0x84, 0x7f, 0xd8
+};
+
+static const uint8_t v5_ad[] = {
+    0
+};
+static const uint8_t v5_plain[] = {
+    0x09, 0x00, 0x4e, 0xe0, 0xac, 0xcf, 0xb1, 0x31, 0x22, 0xc5, 0x84, 0x46,
+    0x25, 0x27, 0xb6, 0x0e, 0x07, 0x78, 0xa1, 0xcc, 0x7f, 0xb5, 0x70, 0xc7,
+    0x44, 0x3d, 0x59, 0x6f, 0xa4, 0x7c, 0xf6, 0xbd, 0x42, 0x14, 0xca, 0xd4,
+    0x2b, 0x5f, 0x0a, 0x26, 0xf5, 0xee, 0x51, 0x1e, 0xf4, 0xfe, 0x1f, 0x6a,
+    0x12, 0xf4, 0xf6, 0xaa, 0xdb, 0xff, 0x2c, 0x86, 0xa1, 0x04, 0x87, 0xb9,
+    0x82, 0x96, 0x22
+};
+static const uint8_t v5_cipher[] = {
+    0xdb, 0x9d, 0xa0, 0x35, 0x33, 0x9f, 0x43, 0xa1, 0x52, 0x45, 0x9c, 0x05,
+    0xcd, 0x69, 0x4e, 0xc3, 0xbd, 0x6a, 0x2f, 0xc6, 0xfe, 0x8f, 0xdd, 0xf1,
+    0x9b, 0x7b, 0x3d, 0x48, 0x2d, 0xf8, 0x35, 0x66, 0xe9, 0xe0, 0x88, 0x64,
+    0x51, 0x81, 0x99, 0xfc, 0x14, 0x6f, 0x0a, 0x32, 0xca, 0x82, 0xef, 0xdb,
+    0x2c, 0x04, 0xa0, 0xb2, 0xcc, 0x5b, 0xc0, 0x5d, 0x6e, 0x76, 0xb5, 0x04,
+    0xbc, 0x07, 0x6d, 0x32, 0xf0, 0xae, 0x19, 0x23, 0x61, 0x80, 0x12, 0x3e,
+    0x6d, 0x40, 0x79, 0xd7, 0x21, 0xb7, 0x2b
+};
+
+static const uint8_t v6_ad[] = {
+    0x7a
+};
+static const uint8_t v6_plain[] = {
+    0x25, 0xc9, 0x7e, 0x6a, 0x25, 0x30, 0x18, 0x98, 0x31, 0x00, 0xb9, 0xc6,
+    0xa2, 0xd3, 0xe9, 0x2c, 0x33, 0x34, 0x01, 0xa3, 0x0d, 0xa4, 0xcd, 0x62,
+    0xdc, 0x68, 0x55, 0x36, 0xf7, 0x05, 0x21, 0x4e, 0x8e, 0xc4, 0x43, 0x74,
+    0xf4, 0x0e, 0x0c, 0x68, 0x68, 0x93, 0x8a, 0x66, 0x60, 0x04, 0x8e, 0xee,
+    0xf7, 0xbb, 0x5d, 0x64, 0x75, 0x22, 0xed, 0xad, 0xd8, 0x95, 0x4d, 0xb5,
+    0x8e, 0xb4, 0x1e, 0xb7
+};
+static const uint8_t v6_cipher[] = {
+    0x85, 0x0e, 0xb7, 0xb9, 0xd6, 0x45, 0x44, 0xf3, 0xb2, 0xf2, 0x97, 0xde,
+    0x21, 0xc3, 0x22, 0xac, 0xe8, 0x2d, 0xd5, 0x1e, 0xa1, 0x12, 0xd5, 0x57,
+    0xa0, 0x11, 0x30, 0x9a, 0x8e, 0x60, 0x82, 0xfa, 0xa4, 0xcd, 0x64, 0x7e,
+    0x2b, 0x91, 0xad, 0xa3, 0x1f, 0x40, 0xc0, 0x42, 0xc0, 0x4a, 0x55, 0x9e,
+    0x03, 0x01, 0xba, 0x48, 0x2a, 0xf4, 0x07, 0x9d, 0x38, 0x8c, 0x44, 0x27,
+    0x2f, 0x8f, 0x79, 0x14, 0x1b, 0xcd, 0x2c, 0xcf, 0x05, 0x3a, 0xb4, 0xcc,
+    0x9d, 0xb9, 0x17, 0x2b, 0x2f, 0x91, 0x7c, 0x4a
+};
+
+static const uint8_t v7_ad[] = {
+    0x4f, 0x41, 0x09, 0xf2, 0x47, 0x8f, 0x8d, 0x03, 0xdc, 0x16, 0x75, 0x38
+};
+static const uint8_t v7_plain[] = {
+    0x3d, 0x73, 0xe9, 0xad, 0xe5, 0x32, 0x9f, 0xf7, 0x27, 0x72, 0x2f, 0x01,
+    0xfd, 0x1b, 0xd4, 0xe8, 0xa4, 0x1e, 0xf9, 0x75, 0xdb, 0x2c, 0x25, 0x51,
+    0x12, 0x81, 0x9f, 0x68, 0xb4, 0x16, 0x12, 0xbf, 0x2d, 0xd3, 0xd2, 0xc4,
+    0x02, 0xc8, 0xba, 0x4a, 0x59, 0x5b, 0xb2, 0x95, 0x20, 0x38, 0xd6, 0x56,
+    0x39, 0xd9, 0x07, 0xac, 0x3b, 0xff, 0x17, 0xf8, 0xac, 0x33, 0x95, 0xdf,
+    0xda, 0x89, 0xe1, 0xf9, 0x9d
+};
+static const uint8_t v7_cipher[] = {
+    0x66, 0x23, 0x2a, 0xe8, 0x83, 0x64, 0xee, 0x6f, 0x0c, 0xfc, 0xea, 0x45,
+    0x5e, 0xdc, 0x6a, 0xff, 0xeb, 0xdd, 0x2a, 0xcb, 0xab, 0x2c, 0x76, 0x0f,
+    0x3a, 0x97, 0x6a, 0x2f, 0xe7, 0x62, 0xca, 0xda, 0xb5, 0x0f, 0xe0, 0xfb,
+    0xe2, 0x62, 0x94, 0xcc, 0x7c, 0xee, 0x05, 0xd0, 0x77, 0xc0, 0x6b, 0xf1,
+    0x56, 0xdb, 0xf0, 0xd2, 0x3d, 0x97, 0xe1, 0x82, 0xd0, 0xa9, 0x0c, 0xb5,
+    0xdf, 0x6d, 0x4f, 0xe8, 0x49, 0xa7, 0x13, 0xf8, 0x67, 0xd2, 0xc7, 0x16,
+    0x6a, 0x56, 0xbe, 0x88, 0xb8, 0xa1, 0x84, 0x13, 0xd2
+};
+
+static const uint8_t v8_ad[] = {
+    0x4d, 0x82, 0x9d, 0x44, 0x37, 0xdc, 0x12, 0x62, 0x66, 0x4b, 0x73, 0x02,
+    0x3d, 0x97, 0x44, 0x23
+};
+static const uint8_t v8_plain[] = {
+    0x6c, 0xbc, 0xd6, 0xa1, 0x9b, 0x22, 0x68, 0x5c, 0x87, 0x40, 0x46, 0x96,
+    0x52, 0x69, 0xa5, 0xf7, 0x36, 0x60, 0xc1, 0x26, 0x1b, 0x96, 0x8b, 0x89,
+    0x49, 0xb9, 0xe9, 0x1d, 0x76, 0x90, 0x87, 0x74, 0x35, 0x38, 0x52, 0x20,
+    0x9d, 0x36, 0x81, 0x36, 0x91, 0xa3, 0x9d, 0x1a, 0x81, 0xd7, 0xb9, 0xbf,
+    0xc8, 0x14, 0x46, 0x6a, 0x54, 0x46, 0x98, 0xe7, 0xc4, 0x51, 0x07, 0x11,
+    0xc6, 0x56, 0x09, 0xdb, 0x67, 0xdb, 0x13, 0x67, 0xc3, 0x77, 0x14, 0x8a,
+    0xe7, 0xaa, 0xb9, 0x42, 0x44, 0x47, 0xa9, 0x23, 0xe8, 0x68, 0x3b, 0x8b,
+    0x36, 0x69, 0x8a, 0xc1, 0xe9, 0xc8, 0x57, 0xd9, 0x4e, 0x4d, 0x0f, 0x85,
+    0x71, 0x32, 0x22, 0x6d, 0x2e, 0xa3, 0x6b, 0x44, 0x9b, 0x41, 0x55, 0xa2,
+    0xc7, 0x6a, 0xed, 0x66, 0xa8, 0x90, 0x22, 0xf9, 0xd6, 0x58, 0x5e, 0x7b,
+    0x73, 0x6d, 0x9c, 0xc2, 0x71, 0xd6, 0xf6
+};
+static const uint8_t v8_cipher[] = {
+    0x45, 0x07, 0x43, 0xf8, 0x84, 0xbd, 0xba, 0xe7, 0x87, 0x79, 0x24, 0x3a,
+    0x0b, 0x5e, 0xb9, 0x2c, 0xf0, 0x9a, 0x43, 0x05, 0x4c, 0x27, 0xf0, 0x9b,
+    0xb5, 0x0b, 0x26, 0x79, 0x82, 0x04, 0x56, 0xb7, 0xc2, 0x50, 0xd8, 0x55,
+    0x93, 0x26, 0xe4, 0xb5, 0xe0, 0x73, 0x50, 0xcc, 0xe1, 0xdc, 0xf3, 0x97,
+    0xb5, 0x2c, 0xc3, 0xd8, 0x51, 0x9f, 0xb0, 0xe3, 0x8d, 0x4d, 0x00, 0xe1,
+    0xf0, 0x6e, 0x37, 0xfa, 0x20, 0x87, 0x38, 0xc1, 0xc6, 0x6d, 0x28, 0xe9,
+    0x82, 0xb2, 0x5e, 0x1f, 0x33, 0xdf, 0x07, 0x98, 0xec, 0x8d, 0x26, 0xd7,
+    0x82, 0xf2, 0xcc, 0x54, 0xef, 0x5c, 0xc6, 0xb7, 0xf5, 0xdc, 0x07, 0xbe,
+    0x19, 0x5a, 0xba, 0x1b, 0xb6, 0x07, 0xe7, 0x8f, 0x1a, 0x94, 0x90, 0xcc,
+    0x3d, 0x6d, 0xad, 0xcd, 0x5c, 0x6e, 0x33, 0xc1, 0x88, 0x11, 0x63, 0xe7,
+    0xd4, 0xe7, 0x04, 0xd2, 0xbe, 0xd0, 0x69, 0xd9, 0x19, 0x4e, 0x96, 0x25,
+    0x54, 0x28, 0xd8, 0xcf, 0x9d, 0xa8, 0x13, 0x96, 0xcc, 0xd0, 0x5a
+};
+
+static const uint8_t v9_ad[] = {
+    0x8a, 0x40, 0x96, 0x30, 0xe9, 0x49, 0x89, 0x8e, 0x49, 0x42, 0x38, 0xe7,
+    0x38, 0xb0, 0xfc, 0xe5, 0x3a
+};
+static const uint8_t v9_plain[] = {
+    0x88, 0xb3, 0xcb, 0xd0, 0x00, 0x07, 0x25, 0x6f, 0xf5, 0x71, 0xba, 0xcd,
+    0x32, 0xf5, 0x6d, 0x78, 0x01, 0x91, 0xee, 0x2d, 0xe2, 0xc9, 0x43, 0xf7,
+    0x47, 0xe9, 0xd3, 0x35, 0xa4, 0xb6, 0x30, 0x5c, 0x66, 0xcc, 0x3d, 0xd1,
+    0x8f, 0x43, 0x4c, 0xcb, 0xd9, 0x3c, 0x7e, 0xc6, 0xdf, 0x60, 0xec, 0x5d,
+    0x44, 0x31, 0xa8, 0xa1, 0x73, 0xee, 0x87, 0x19, 0xd8, 0x1b, 0x68, 0x0e,
+    0x61, 0x2c, 0x90, 0xda, 0x1c, 0x56, 0xc0, 0xb9, 0xe6, 0xc7, 0x1d, 0xec,
+    0x07, 0x23, 0xf2, 0x98, 0xd5, 0x90, 0xae, 0xd4, 0xc6, 0xb4, 0x46, 0x39,
+    0xfd, 0xa7, 0x1f, 0xc7, 0xbd, 0xa9, 0xb2, 0xc8, 0x30, 0x92, 0xf0, 0xf2,
+    0xd8, 0x3b, 0x87, 0xd0, 0x8f, 0xec, 0xb4, 0xd1, 0x85, 0x83, 0xd6, 0xf0,
+    0x5e, 0xf8, 0x38, 0xd5, 0x20, 0xca, 0x9e, 0xca, 0x34, 0xe0, 0x4f, 0x80,
+    0x9d, 0x0d, 0xc0, 0x04, 0x24, 0x9c, 0xfe, 0xfe
+};
+static const uint8_t v9_cipher[] = {
+    0xb7, 0x69, 0x25, 0x1d, 0xe1, 0xf4, 0x5d, 0xd7, 0x88, 0x3c, 0x6c, 0x2b,
+    0x07, 0xe8, 0x5d, 0x75, 0x55, 0xac, 0x7d, 0xbc, 0x36, 0xf7, 0x93, 0x85,
+    0xc2, 0x5a, 0x85, 0xfb, 0x00, 0x60, 0x3b, 0x48, 0xfa, 0x5a, 0xf3, 0x06,
+    0xad, 0x6c, 0x76, 0xcf, 0x6d, 0xf3, 0xaf, 0xfc, 0x0c, 0x21, 0x8f, 0xf0,
+    0x8b, 0x74, 0x5e, 0x62, 0xb5, 0xbd, 0xc4, 0x4b, 0x19, 0x3e, 0xd6, 0x14,
+    0x64, 0x41, 0xba, 0xa9, 0x0f, 0x49, 0xf8, 0xfa, 0xaa, 0xdf, 0xf6, 0x3f,
+    0xcb, 0x01, 0xf2, 0x86, 0x95, 0x31, 0xb0, 0x9a, 0x0f, 0x1f, 0xad, 0xc4,
+    0x90, 0xab, 0x11, 0x98, 0x1f, 0x9e, 0x51, 0x5a, 0x28, 0xe3, 0x05, 0x88,
+    0xe1, 0x7b, 0x3a, 0x6f, 0xb5, 0xa6, 0x9a, 0x62, 0xce, 0x5c, 0xe5, 0xba,
+    0x16, 0xbe, 0xb8, 0x9b, 0x4e, 0xf5, 0x35, 0x53, 0xc4, 0xb2, 0x9f, 0xe0,
+    0x0b, 0x0e, 0x31, 0x5c, 0x28, 0xc1, 0x26, 0x5c, 0xa1, 0xc4, 0x75, 0x9f,
+    0xce, 0xee, 0x7a, 0x01, 0x17, 0xdf, 0xc9, 0x04, 0x0a, 0xe4, 0x52, 0xf6
+};
+
+static const uint8_t v10_ad[] = {
+    0
+};
+static const uint8_t v10_plain[] = {
+    0xc8, 0x7b, 0xc0, 0xd8, 0x26, 0x91, 0x35, 0xa0, 0xc8, 0xa2, 0x3d, 0x6a,
+    0xff, 0x2c, 0x62, 0x60, 0x3f, 0xa7, 0x5c, 0x2e, 0x9f, 0x46, 0xeb, 0x1e,
+    0x77, 0x67, 0x0a, 0x7d, 0x38, 0xb1, 0xd4, 0xab, 0x3a, 0x38, 0x91, 0x9a,
+    0x8f, 0x04, 0xc9, 0x06, 0x7e, 0x83, 0x64, 0xd9, 0x78, 0xe7, 0x5b, 0x1e,
+    0xf5, 0x87, 0xa1, 0x72, 0x7c, 0x34, 0x38, 0x19, 0x94, 0xc0, 0xde, 0x88,
+    0xbb, 0xe7, 0x35, 0x1f, 0x72, 0x6b, 0x85, 0x93, 0xfe, 0xf0, 0x33, 0x62,
+    0x65, 0x35, 0x62, 0xa8, 0xbd, 0x26, 0x60, 0xf7, 0x28, 0x65, 0x74, 0x2b,
+    0x82, 0x55, 0xf5, 0xd9, 0xec, 0xfe, 0x92, 0xea, 0xc7, 0x7b, 0x2f, 0x36,
+    0x64, 0xbc, 0xb0, 0xb2, 0x37, 0x25, 0xf2, 0xfa, 0xb4, 0xc3, 0xac, 0x56,
+    0x81, 0x07, 0x17, 0x56, 0x1e, 0x3c, 0x81, 0x11, 0x12, 0xec, 0x15, 0xfc,
+    0x55, 0x2a, 0x9d, 0xde, 0x9d, 0xb4, 0xb1, 0x92, 0xc0
+};
+static const uint8_t v10_cipher[] = {
+    0xde, 0x52, 0xf0, 0x99, 0xc5, 0x0e, 0x56, 0x43, 0x79, 0x1a, 0xe5, 0x2d,
+    0x40, 0x72, 0xec, 0xbe, 0xc5, 0xa5, 0x3c, 0xd8, 0x4f, 0xfc, 0x5a, 0xa2,
+    0x8a, 0x99, 0x8d, 0x2b, 0x41, 0xfa, 0xb5, 0xf9, 0x56, 0xc1, 0x69, 0x9a,
+    0x5f, 0x3e, 0x1a, 0x1f, 0xe2, 0x2d, 0xeb, 0xd7, 0xef, 0xfd, 0xf1, 0x0c,
+    0xad, 0x8a, 0xe8, 0xe6, 0x1a, 0x5d, 0xd2, 0x1c, 0xcc, 0xdc, 0x86, 0xb9,
+    0xee, 0xbd, 0x60, 0xbf, 0x95, 0x75, 0x66, 0x95, 0x23, 0xdb, 0x05, 0xc3,
+    0x66, 0x77, 0x49, 0x95, 0xf7, 0xdb, 0x9e, 0xdc, 0xaf, 0x50, 0xe9, 0xca,
+    0x24, 0xf8, 0x47, 0x92, 0x82, 0x4a, 0xba, 0xa6, 0x80, 0xda, 0x41, 0x6e,
+    0xf0, 0xd2, 0x21, 0x8a, 0x6c, 0x83, 0x38, 0x10, 0x12, 0xd3, 0xd2, 0x1d,
+    0x28, 0x8d, 0x01, 0xe3, 0xf1, 0xdd, 0xa6, 0xde, 0xe0, 0x38, 0x09, 0x27,
+    0x11, 0x10, 0xed, 0xbc, 0x8d, 0xc8, 0x22, 0x0f, 0xd6, 0x87, 0x3d, 0x49,
+    0x36, 0x6a, 0xb6, 0x19, 0x34, 0xee, 0x1f, 0x23, 0x17, 0xb1, 0x2f, 0x32,
+    0x58
+};
+
+static const uint8_t v11_ad[] = {
+    0x31
+};
+static const uint8_t v11_plain[] = {
+    0x0c, 0xf0, 0x40, 0xaa, 0x95, 0x4d, 0xb7, 0x2a, 0x62, 0xd4, 0x4d, 0x1c,
+    0x8c, 0xbb, 0xb2, 0x53, 0xef, 0x91, 0x68, 0xc4, 0x2c, 0xd3, 0x25, 0x22,
+    0x5c, 0xb1, 0x1c, 0x9f, 0x6c, 0x68, 0x3c, 0x24, 0x5e, 0xb3, 0x9a, 0xb0,
+    0xd0, 0x50, 0x33, 0x4d, 0xae, 0x9e, 0xa1, 0x72, 0x04, 0x3a, 0x9b, 0x65,
+    0x2b, 0x35, 0x03, 0x07, 0x8a, 0xe2, 0x0a, 0xc1, 0x58, 0x4b, 0x46, 0xfe,
+    0xbf, 0xe3, 0xf4, 0x16, 0xd6, 0xba, 0x61, 0x71, 0x5f, 0xac, 0xbc, 0xb4,
+    0xf3, 0x66, 0x87, 0xf5, 0x12, 0x5f, 0x8b, 0xf7, 0x2f, 0x9b, 0x7f, 0x7b,
+    0xba, 0xdc, 0x00, 0x95, 0xca, 0x63, 0x73, 0x56, 0x74, 0xe6, 0xf4, 0x23,
+    0xc3, 0x92, 0x1b, 0x0e, 0xaf, 0xea, 0x71, 0x8b, 0x3a, 0xd3, 0x14, 0xa7,
+    0xba, 0xf3, 0xac, 0x64, 0x30, 0x3f, 0xcd, 0x63, 0x90, 0x51, 0xec, 0xa5,
+    0xdf, 0xa6, 0x3a, 0x42, 0x06, 0xa7, 0x1b, 0x4d, 0xf1, 0xb3, 0x35, 0x5d,
+    0xbe, 0x1d, 0xe3, 0x1e, 0x47, 0xbd, 0xe6, 0x23, 0x40, 0x37, 0xac, 0x15,
+    0x2b, 0x19, 0x64, 0xf7, 0x60, 0xb4, 0x0b, 0x1a, 0x10, 0x6c, 0x85, 0xe7,
+    0x75, 0x1c, 0x86, 0x05, 0xa7, 0xe5, 0x01, 0x7b, 0xd3, 0xe2, 0xff, 0xde,
+    0xb6, 0x6f, 0xc4, 0xcc, 0xf0, 0x66, 0x9c, 0x6c, 0xef, 0x79, 0xa1, 0x88,
+    0x9b, 0xd6, 0x04, 0xa4, 0xf7, 0xcd, 0x02, 0x2a, 0x71, 0x08, 0x8f
+};
+static const uint8_t v11_cipher[] = {
+    0x35, 0x58, 0xac, 0x87, 0x96, 0xfc, 0xa5, 0xbd, 0x69, 0x1e, 0xc6, 0x02,
+    0x9e, 0xf9, 0xd9, 0x63, 0xdd, 0x98, 0xef, 0xa3, 0xb2, 0xfa, 0x53, 0x8b,
+    0xa6, 0x9d, 0xe2, 0xd9, 0x92, 0x4a, 0x16, 0xc4, 0x79, 0x6f, 0xb5, 0xf3,
+    0xd1, 0x29, 0x1b, 0xe1, 0x55, 0xc3, 0x43, 0x79, 0x17, 0x94, 0x4a, 0xa6,
+    0x4d, 0x0d, 0xdf, 0xff, 0x0c, 0xec, 0x62, 0x39, 0x4b, 0x92, 0xb8, 0xef,
+    0x0d, 0x6b, 0x50, 0x74, 0xaa, 0x5d, 0x74, 0x4e, 0xc5, 0x22, 0x70, 0x04,
+    0xe0, 0x36, 0x18, 0x00, 0x58, 0xa7, 0xb4, 0x11, 0x43, 0xb3, 0x84, 0xf5,
+    0x58, 0x95, 0xfc, 0x5e, 0x30, 0x32, 0x5c, 0x2e, 0x00, 0x6d, 0x28, 0xc4,
+    0xb9, 0x79, 0x6b, 0x0f, 0xd1, 0x2b, 0xe5, 0xe8, 0x64, 0xd4, 0x97, 0x19,
+    0x48, 0x47, 0xa6, 0x4c, 0x9e, 0x52, 0x4b, 0x55, 0xbe, 0xfc, 0x83, 0x3b,
+    0x2f, 0x3e, 0x08, 0x79, 0xf7, 0xc0, 0xb0, 0x16, 0x7d, 0x6f, 0x89, 0xa9,
+    0x89, 0x69, 0xd8, 0xc7, 0x94, 0x35, 0xd1, 0x19, 0xe2, 0x6c, 0xfa, 0x6c,
+    0xca, 0xcb, 0x56, 0x06, 0x8f, 0x8b, 0xf9, 0x8e, 0x12, 0xa6, 0x1d, 0xb8,
+    0x45, 0x31, 0x99, 0xcd, 0x1c, 0x03, 0xa8, 0x00, 0x37, 0xfd, 0x3c, 0xb7,
+    0x2b, 0xef, 0x2b, 0xea, 0x34, 0xc3, 0x5b, 0xce, 0x21, 0x91, 0x6c, 0x28,
+    0x42, 0xbc, 0xea, 0x9e, 0x99, 0x07, 0x08, 0xe3, 0x5c, 0x62, 0x49, 0x5c,
+    0xc2, 0xec, 0xe5, 0x60, 0x4b, 0x31, 0xbf, 0x4a, 0xbe, 0x13, 0x4c, 0x87,
+    0x31, 0x40, 0x5e
+};
+
+static const uint8_t v12_ad[] = {
+    0xc1, 0xf9, 0x9e, 0x6a, 0xda, 0xe0, 0xa5, 0x7e, 0xad, 0x16, 0x3d, 0x37
+};
+static const uint8_t v12_plain[] = {
+    0xa5, 0x6d, 0xcd, 0x45, 0x9c, 0x18, 0x1e, 0x91, 0xb7, 0x19, 0xad, 0x3f,
+    0xbf, 0x26, 0xbe, 0x55, 0x38, 0x2a, 0x7e, 0x63, 0xc6, 0xa7, 0x25, 0x20,
+    0xb6, 0xa7, 0xdd, 0x89, 0x8c, 0x5f, 0x70, 0xff, 0x78, 0x28, 0xa1, 0x00,
+    0xc1, 0xe7, 0xd1, 0xd1, 0xfc, 0xd6, 0x44, 0x26, 0x31, 0xe2, 0xea, 0x9d,
+    0x58, 0xf5, 0x38, 0xa6, 0x1e, 0x29, 0xf5, 0x62, 0x47, 0xe5, 0x56, 0x60,
+    0xb8, 0xa7, 0x07, 0x9a, 0x2a, 0x5c, 0x49, 0x4b, 0x54, 0xed, 0x18, 0x92,
+    0xe4, 0xdc, 0x77, 0x37, 0x68, 0x8a, 0xe6, 0x20, 0x4c, 0x14, 0x12, 0xbc,
+    0xf9, 0xfa, 0x63, 0x56, 0x59, 0xc5, 0x3b, 0x08, 0x6d, 0x27, 0xfb, 0x9d,
+    0xb4, 0x80, 0x4c, 0xba, 0x68, 0x3e, 0xfa, 0x4e, 0x95, 0x7b, 0xac, 0x2c,
+    0x50, 0x0d, 0x36, 0x8a, 0xd5, 0x0d, 0x39, 0xd5, 0xf8, 0xda, 0x3b, 0x81,
+    0x5c, 0xb4, 0x48, 0xe3, 0x24, 0x5a, 0x48, 0x2e, 0x5b, 0xdf, 0xad, 0xda,
+    0x62, 0xd8, 0x28, 0x6d, 0x12, 0x3c, 0xc3, 0xee, 0xed, 0x71, 0xa9, 0xa2,
+    0xb8, 0x7c, 0xaa, 0xcd, 0xde, 0x55, 0x6f, 0xa0, 0x4f, 0xc8, 0x06, 0x50,
+    0x74, 0x0f, 0xd1, 0x95, 0x29, 0x95, 0xa8, 0xdc, 0x8d, 0x30, 0x21, 0x1b,
+    0xce, 0xf6, 0x7c, 0xa7, 0x78, 0x86, 0xf3, 0xcc, 0xd0, 0xb1, 0x4c, 0x02,
+    0x4c, 0x68, 0xd7, 0xb9, 0x5a, 0x18, 0xd4, 0x25, 0x02, 0xd6, 0x4e, 0x69,
+    0x64, 0xf0, 0x8d, 0x3a, 0xe2, 0x6c, 0x19, 0x4c, 0x9e, 0x40, 0x21, 0x20,
+    0xd8, 0xcd, 0x06, 0x42, 0x88, 0x78, 0x73, 0x71, 0xc7, 0x2c, 0xed, 0xaf,
+    0x9e, 0x5d, 0x02, 0x84, 0x2c, 0x4a, 0xd3, 0x43, 0xcc, 0x75, 0x04, 0xea,
+    0x06, 0x8f, 0x80, 0x87, 0x4f, 0xb4, 0x40, 0xbf, 0xe7, 0xd1, 0x90, 0xf8,
+    0x0d, 0x04, 0xae, 0x6c, 0x61, 0x52, 0x51, 0x7f, 0xe5, 0x7d
+};
+static const uint8_t v12_cipher[] = {
+    0x76, 0xa8, 0x52, 0x8f, 0x7b, 0xb4, 0xf1, 0x14, 0x22, 0x8e, 0xed, 0x7a,
+    0x3a, 0xe6, 0x2b, 0x17, 0x09, 0x8c, 0xe2, 0x9f, 0x25, 0x3a, 0x26, 0x56,
+    0xa6, 0x73, 0x33, 0x32, 0x20, 0x26, 0x93, 0xd5, 0xa1, 0x17, 0xc1, 0x77,
+    0x10, 0xe1, 0x7b, 0x62, 0xc2, 0x43, 0x94, 0x70, 0x54, 0x60, 0xb7, 0xc2,
+    0xe6, 0x5e, 0x7a, 0x89, 0xe9, 0xbc, 0xac, 0x75, 0x2e, 0xf3, 0x0a, 0x69,
+    0x83, 0x06, 0xfc, 0x37, 0x7c, 0x9d, 0xba, 0x9a, 0xe6, 0x25, 0xa7, 0xdb,
+    0x93, 0x3a, 0xc3, 0xeb, 0xbc, 0x49, 0x0b, 0xbd, 0x6d, 0xef, 0xdd, 0x2b,
+    0xe5, 0xc2, 0xd0, 0x69, 0xd3, 0x85, 0x0a, 0x47, 0x7c, 0x8d, 0xba, 0xd6,
+    0x6d, 0xae, 0xcc, 0xa6, 0x74, 0x9b, 0xf0, 0xf1, 0x70, 0x60, 0x1a, 0x5e,
+    0xe8, 0x8b, 0x5f, 0xd2, 0x00, 0x92, 0x15, 0x28, 0x6d, 0x04, 0x06, 0x0b,
+    0x87, 0xcd, 0x8a, 0xd8, 0xb1, 0x5b, 0x8f, 0xce, 0xf5, 0xe3, 0x0f, 0xb5,
+    0x51, 0xea, 0x6e, 0x63, 0x1c, 0x69, 0xc7, 0xd9, 0x56, 0x7d, 0xb9, 0x0d,
+    0xcb, 0xf1, 0x13, 0x83, 0x7f, 0x2c, 0x8b, 0xdb, 0xb8, 0x1b, 0xd9, 0x25,
+    0x60, 0x3d, 0x65, 0x8f, 0xe4, 0x16, 0x5a, 0xe1, 0x68, 0x77, 0xd2, 0xab,
+    0x79, 0x65, 0xf9, 0x57, 0xe1, 0xa5, 0xd0, 0x5a, 0x36, 0x9e, 0xb7, 0x95,
+    0x2d, 0xbd, 0xab, 0x8c, 0xb8, 0x5c, 0x42, 0x4f, 0x74, 0x4b, 0xf7, 0x32,
+    0x12, 0xf9, 0xf9, 0x8c, 0x8f, 0xba, 0xea, 0x6b, 0x6b, 0x3a, 0x7b, 0x16,
+    0xbf, 0x77, 0xcf, 0x7c, 0xce, 0x30, 0xa3, 0x1f, 0xf7, 0xd6, 0x4d, 0x2b,
+    0xe0, 0xf1, 0x03, 0x7f, 0x1e, 0x77, 0xbd, 0x65, 0x0a, 0x4c, 0xbe, 0x71,
+    0x26, 0x33, 0x9f, 0xda, 0xc2, 0x79, 0x0d, 0x0b, 0x6c, 0xd3, 0x08, 0xb2,
+    0x4d, 0xf1, 0xf0, 0xa0, 0x7a, 0xc0, 0x77, 0x4f, 0xb1, 0x66, 0x3d, 0x38,
+    0xf5, 0x80, 0x75, 0xab, 0xb0, 0x0e, 0xf4, 0x3b, 0x63, 0x48, 0xbd, 0xd2,
+    0x5a, 0xbd
+};
+
+static const uint8_t v13_ad[] = {
+    0x5c, 0xc9, 0xa4, 0xac, 0x5a, 0x31, 0xb3, 0x2c, 0x83, 0x49, 0x60, 0x63,
+    0x56, 0x25, 0x26, 0x5a
+};
+static const uint8_t v13_plain[] = {
+    0x8e, 0x23, 0x60, 0xfe, 0x43, 0x54, 0xe8, 0x53, 0x58, 0x19, 0x08, 0x18,
+    0x8b, 0xa6, 0x80, 0x75, 0xa9, 0x4d, 0xc4, 0x58, 0x7c, 0x84, 0x65, 0xab,
+    0x03, 0x05, 0x0d, 0x0c, 0xdf, 0xc4, 0x4b, 0xa5, 0x28, 0x7e, 0x73, 0xa5,
+    0x75, 0xc4, 0xe0, 0x35, 0x2d, 0x92, 0x8a, 0x13, 0x57, 0x05, 0x17, 0x54,
+    0xaf, 0x1e, 0x9b, 0x49, 0x81, 0xef, 0x95, 0xd2, 0x5d, 0x2a, 0x8d, 0xff,
+    0x15, 0xc8, 0x88, 0x9d, 0x9a, 0x1d, 0xde, 0x1e, 0x14, 0xad, 0xf9, 0x54,
+    0x51, 0x7a, 0xc3, 0xd3, 0x9e, 0x0c, 0xac, 0xc1, 0xc1, 0xe2, 0x44, 0x49,
+    0xb7, 0x5f, 0x37, 0x66, 0x4d, 0x60, 0xb5, 0x9c, 0x2a, 0xa9, 0x67, 0xf3,
+    0x85, 0xa1, 0x41, 0x63, 0x6b, 0x16, 0x79, 0xab, 0xfb, 0xf3, 0x39, 0x20,
+    0xfc, 0xb7, 0xd0, 0x43, 0x8e, 0x20, 0x0e, 0xed, 0xdb, 0x1b, 0xd5, 0xc0,
+    0x72, 0x3c, 0x33, 0x22, 0xd9, 0xa9, 0xfc, 0x96, 0x0d, 0xbb, 0xff, 0x62,
+    0xb0, 0x86, 0xab, 0xa8, 0xc6, 0x5d, 0x94, 0x68, 0xce, 0x6c, 0x01, 0x0a,
+    0x88, 0xe2, 0x10, 0x1a, 0x4e, 0x59, 0x22, 0xc4, 0x82, 0x1f, 0xdb, 0x13,
+    0x7d, 0x20, 0xc5, 0xd4, 0x37, 0x4d, 0xab, 0x85, 0x74, 0xe2, 0xad, 0x22,
+    0x40, 0x25, 0xb7, 0x90, 0x5e, 0x9a, 0xc1, 0x78, 0xee, 0x62, 0xa3, 0x7e,
+    0x58, 0x38, 0x8a, 0xb2, 0x98, 0x93, 0xae, 0xc1, 0x98, 0xd5, 0xbd, 0xb3,
+    0x9f, 0x14, 0x13, 0x64, 0x9e, 0x6c, 0x3f, 0x8f, 0xdc, 0x59, 0x17, 0xe9,
+    0x1a, 0xdf, 0xbc, 0xae, 0xdd, 0x25, 0x22, 0x0a, 0x4f, 0x2d, 0x84, 0xaa,
+    0x9a, 0xa7, 0xb4, 0x7d, 0xc8, 0xca, 0xf0, 0x31, 0x00, 0x6a, 0xb7, 0xe9,
+    0x19, 0xaf, 0x58, 0x41, 0xc3, 0xdd, 0x71, 0x75, 0x8b, 0x9e, 0xde, 0x9c,
+    0xbd, 0x52, 0x10, 0x19, 0xca, 0xf2, 0xad, 0xc7, 0x3b, 0x9b, 0x55, 0x25,
+    0xc5, 0x72, 0x5f
+};
+static const uint8_t v13_cipher[] = {
+    0x17, 0x6b, 0xb3, 0x7f, 0xc9, 0x1d, 0x7b, 0x6c, 0x51, 0xf3, 0x87, 0xdb,
+    0xe7, 0x15, 0xe7, 0x61, 0x74, 0x78, 0x97, 0x08, 0xda, 0xd4, 0x30, 0x50,
+    0xd9, 0xfa, 0x41, 0x63, 0x9c, 0x10, 0xb6, 0x93, 0x84, 0x10, 0x51, 0xf4,
+    0x25, 0xdc, 0xea, 0x85, 0x49, 0xeb, 0xce, 0xca, 0xb3, 0xa8, 0x75, 0x34,
+    0x53, 0x2e, 0xcd, 0xa5, 0xf8, 0x37, 0xdb, 0xec, 0xff, 0xe9, 0x4e, 0xa7,
+    0x6f, 0x65, 0xca, 0xc7, 0xe0, 0x43, 0xb9, 0x6a, 0xce, 0x28, 0xcb, 0xdf,
+    0xbe, 0x22, 0x3b, 0x5d, 0x0f, 0xf9, 0x87, 0x24, 0x37, 0x63, 0x31, 0xb4,
+    0x97, 0xf6, 0x51, 0x1d, 0xa5, 0x89, 0x31, 0x6a, 0x90, 0x26, 0xf8, 0x3f,
+    0x74, 0xb5, 0x5f, 0xf8, 0x02, 0x74, 0x06, 0xea, 0xbf, 0xc1, 0xc0, 0x20,
+    0x27, 0xf8, 0x83, 0x08, 0x47, 0xe6, 0x9b, 0x11, 0xa0, 0x65, 0x2d, 0x7e,
+    0x89, 0x28, 0xde, 0x34, 0xce, 0x6a, 0x0b, 0xe2, 0xbd, 0x90, 0x31, 0xef,
+    0xd0, 0xfc, 0x6d, 0xc8, 0x2b, 0xd3, 0x46, 0xbc, 0x2f, 0xe0, 0x94, 0x86,
+    0x75, 0x63, 0xf1, 0x8d, 0x4e, 0xee, 0xd7, 0xbf, 0x96, 0x56, 0x5f, 0x5c,
+    0xec, 0x3a, 0x74, 0x74, 0x2e, 0xb7, 0xea, 0x1f, 0x77, 0x06, 0x89, 0xd5,
+    0x9c, 0x53, 0xb7, 0x80, 0xa3, 0x9b, 0xf9, 0x4d, 0x9a, 0x32, 0xd1, 0x96,
+    0xf3, 0xbf, 0x7b, 0x4d, 0xd6, 0x70, 0xf8, 0xc0, 0xf1, 0x08, 0xe0, 0xae,
+    0x98, 0x77, 0xf4, 0x9c, 0xf6, 0x63, 0x97, 0x7f, 0x9f, 0x47, 0x14, 0xf9,
+    0xbf, 0xb7, 0xae, 0x4b, 0x77, 0x5b, 0x07, 0x61, 0xb0, 0xea, 0x82, 0x7f,
+    0x73, 0x6e, 0x02, 0xb3, 0xd8, 0x82, 0x89, 0x25, 0x8e, 0xb5, 0xd1, 0x91,
+    0xdc, 0xe0, 0x6d, 0x7d, 0x9b, 0x96, 0xca, 0xea, 0x06, 0x06, 0xd6, 0xe0,
+    0xbc, 0x0e, 0xb5, 0x2e, 0xfc, 0xbf, 0x94, 0xd9, 0x79, 0xc2, 0xf8, 0xa8,
+    0x35, 0x7f, 0xea, 0x44, 0x0d, 0x05, 0x04, 0x67, 0xdc, 0x86, 0x6d, 0x06,
+    0x41, 0x60, 0x93, 0xc4, 0xb5, 0x6c, 0xde
+};
+
+static const uint8_t v14_ad[] = {
+    0xe2, 0x6a, 0x1a, 0x47, 0x2e, 0x1c, 0x5b, 0x90, 0x9d, 0x36, 0x7a, 0xec,
+    0xd4, 0x11, 0xe8, 0x6f, 0x24
+};
+static const uint8_t v14_plain[] = {
+    0xf7, 0xb2, 0xdd, 0x8b, 0xcd, 0x92, 0xf2, 0x18, 0x65, 0xd4, 0x93, 0x1a,
+    0x86, 0xb7, 0x6a, 0x41, 0x0e, 0xa2, 0xc8, 0x30, 0x6b, 0x9f, 0x62, 0xcc,
+    0xd6, 0x5c, 0xf9, 0xa9, 0xf9, 0x7b, 0xda, 0x21, 0x5f, 0xd4, 0xfb, 0x0f,
+    0x17, 0xca, 0x8b, 0x99, 0xdc, 0x59, 0x2f, 0x56, 0xe2, 0x95, 0x8d, 0x5b,
+    0x18, 0x9f, 0x2c, 0x60, 0xb2, 0xd7, 0xfb, 0xf2, 0x64, 0x03, 0xee, 0xbf,
+    0xae, 0x44, 0x91, 0x37, 0x3c, 0x5b, 0x46, 0x1f, 0xc4, 0x6d, 0x51, 0x73,
+    0xf1, 0xd6, 0x18, 0x9b, 0x72, 0x9b, 0x9a, 0x0e, 0x8d, 0xea, 0x29, 0x6b,
+    0xc5, 0x2e, 0x3a, 0xda, 0x95, 0xe0, 0x19, 0x49, 0xd1, 0x51, 0x63, 0x89,
+    0xf2, 0x7a, 0x9b, 0xf0, 0xde, 0xd8, 0x09, 0x2e, 0x8c, 0x4b, 0xb2, 0x69,
+    0xa0, 0xee, 0x1c, 0x9d, 0x65, 0xb5, 0x73, 0xdf, 0x4f, 0x0f, 0x9e, 0x84,
+    0xb1, 0xa2, 0x87, 0xa5, 0xa6, 0xa2, 0x53, 0x19, 0xde, 0xba, 0xe3, 0x89,
+    0x39, 0xc1, 0xa3, 0x94, 0x4d, 0xc7, 0xf1, 0x32, 0x03, 0xed, 0xf0, 0xd3,
+    0xcc, 0xa8, 0x76, 0xc0, 0x4d, 0x1c, 0xc9, 0x71, 0x3b, 0x94, 0xfd, 0x4f,
+    0x40, 0x95, 0xba, 0x29, 0x85, 0x03, 0xc9, 0x65, 0x1e, 0x81, 0x6c, 0xec,
+    0x9d, 0xf6, 0x24, 0x37, 0x94, 0xf1, 0x48, 0x0c, 0x72, 0xec, 0xed, 0xae,
+    0x74, 0xbd, 0x5e, 0x73, 0xb4, 0xc4, 0x37, 0x7f, 0xb3, 0x26, 0x8e, 0x47,
+    0x8f, 0x11, 0x38, 0x39, 0x6c, 0xc9, 0xa1, 0x8c, 0x5f, 0x70, 0x39, 0x70,
+    0xc7, 0xaf, 0x22, 0x54, 0xc0, 0x57, 0x16, 0xa7, 0xe0, 0xa0, 0x3e, 0x76,
+    0xf8, 0x35, 0x11, 0x72, 0x3e, 0x43, 0x15, 0xae, 0x03, 0x5d, 0xad, 0x43,
+    0xbc, 0xf9, 0xd2, 0xb3, 0x47, 0x2e, 0xb3, 0x36, 0x83, 0x82, 0x46, 0xf0,
+    0xd7, 0xa2, 0xcc, 0xbc, 0x0d, 0x2e, 0xae, 0x55, 0xcc, 0xfe, 0x66, 0xb1,
+    0xd3, 0xab, 0xcb, 0x67
+};
+static const uint8_t v14_cipher[] = {
+    0x26, 0x2b, 0xe5, 0xc0, 0x2c, 0x6a, 0x5a, 0x0d, 0xe7, 0x30, 0x48, 0x56,
+    0xab, 0xfd, 0xc5, 0x75, 0x88, 0x70, 0x58, 0x01, 0x09, 0xbd, 0xe5, 0xe5,
+    0x02, 0x92, 0x28, 0xd6, 0xa6, 0x1c, 0xeb, 0x14, 0xa4, 0x25, 0xc7, 0x3d,
+    0x08, 0x34, 0x95, 0xb6, 0x5b, 0xb5, 0xf7, 0xd6, 0xa2, 0x12, 0x21, 0x86,
+    0xdb, 0xfa, 0xc9, 0xfd, 0x77, 0xfe, 0xe2, 0x3f, 0xfd, 0x07, 0x0c, 0x61,
+    0x67, 0x2f, 0xb6, 0x3d, 0x66, 0xe9, 0x50, 0xb3, 0x37, 0xf4, 0x99, 0x77,
+    0x16, 0xfc, 0xfa, 0x72, 0x1f, 0x42, 0x26, 0x00, 0xe0, 0xfc, 0x2d, 0x7a,
+    0x4a, 0x12, 0x7a, 0xed, 0xaa, 0x0c, 0x94, 0x13, 0x06, 0x92, 0x20, 0xbd,
+    0x2e, 0x4e, 0xce, 0xce, 0x58, 0x7f, 0xdc, 0xc4, 0xb2, 0x82, 0xd4, 0xc6,
+    0x1d, 0x7d, 0x4f, 0xb7, 0x2f, 0xab, 0xc6, 0x21, 0x71, 0xfc, 0x2f, 0xa5,
+    0xc6, 0xa0, 0x7b, 0x54, 0xbb, 0x0e, 0x2d, 0x58, 0xe5, 0x69, 0xd1, 0x72,
+    0x43, 0x66, 0xe8, 0x9e, 0x06, 0x2b, 0x37, 0xfc, 0x21, 0x16, 0x40, 0xc8,
+    0x6c, 0x91, 0x98, 0xd0, 0x7b, 0x51, 0xc8, 0x59, 0x0a, 0x6c, 0xfd, 0xd3,
+    0xb2, 0xc7, 0xe8, 0xee, 0xe9, 0x6b, 0x72, 0x9e, 0xb1, 0x3e, 0x58, 0x45,
+    0x62, 0x0d, 0xe0, 0xc4, 0x85, 0x5d, 0x4e, 0x37, 0x9c, 0xe6, 0xb9, 0xf8,
+    0x8a, 0xc8, 0x5a, 0xc3, 0x38, 0x85, 0xcd, 0x55, 0x3f, 0xb8, 0x01, 0x80,
+    0x06, 0x36, 0xe9, 0x52, 0x19, 0x72, 0x84, 0x66, 0x18, 0xe4, 0x70, 0x51,
+    0xf9, 0xf7, 0x8d, 0xf3, 0xd2, 0xd0, 0x64, 0xf5, 0xdf, 0x71, 0x98, 0x4d,
+    0xf4, 0x1b, 0xae, 0xc1, 0xf3, 0x5b, 0xd0, 0xd5, 0x4e, 0xae, 0x4c, 0x03,
+    0x86, 0xd5, 0xc7, 0x0e, 0xcf, 0x83, 0x78, 0x23, 0x2a, 0xa4, 0x7f, 0x4b,
+    0xf2, 0x5b, 0x15, 0x9d, 0xb9, 0x4c, 0x19, 0xb2, 0x43, 0x0d, 0xe8, 0x65,
+    0xba, 0x99, 0x5a, 0x02, 0x30, 0xe8, 0x9d, 0xfc, 0x28, 0x0f, 0xfe, 0xae,
+    0x53, 0xf4, 0xbc, 0x8d, 0x8b, 0xb0, 0x7c, 0x86
+};
+
+static const uint8_t v15_ad[] = {
+    0
+};
+static const uint8_t v15_plain[] = {
+    0x28, 0x68, 0x5c, 0x28, 0xd0, 0xd3, 0x2c, 0xf2, 0xa4, 0xf9, 0x5d, 0x19,
+    0x27, 0x2b, 0xa0, 0x7c, 0x51, 0x56, 0x24, 0x84, 0xf5, 0x8e, 0x2a, 0x1d,
+    0x19, 0x16, 0x40, 0x1a, 0x18, 0x20, 0x8f, 0x6c, 0x41, 0x0e, 0x3c, 0x96,
+    0x46, 0x29, 0xc7, 0x9b, 0xf8, 0xd5, 0x75, 0x6c, 0x7c, 0x5e, 0xaa, 0x3f,
+    0x70, 0xfa, 0x1a, 0x03, 0x59, 0xe4, 0x33, 0x5b, 0xfb, 0x89, 0xb0, 0x9e,
+    0x55, 0x60, 0xea, 0xaa, 0x76, 0xed, 0xb2, 0x2a, 0x2b, 0xe6, 0xcf, 0x4d,
+    0xf1, 0x40, 0x2a, 0x20, 0x34, 0xad, 0x51, 0xb7, 0x9d, 0x9f, 0x58, 0x35,
+    0x05, 0xf5, 0xc4, 0x5f, 0xc8, 0xae, 0xdd, 0x22, 0xc6, 0x57, 0x28, 0xea,
+    0x20, 0x40, 0x0b, 0x0e, 0xa2, 0x6c, 0x96, 0x8a, 0x7b, 0x1b, 0x38, 0xef,
+    0x68, 0xdb, 0x5f, 0x3d, 0xab, 0x72, 0xc1, 0xc8, 0x74, 0x16, 0x30, 0x58,
+    0x56, 0x56, 0xae, 0xd2, 0x99, 0x5d, 0xe9, 0x6c, 0x98, 0xfc, 0x0b, 0x5d,
+    0x51, 0xe3, 0x0d, 0xd5, 0x81, 0x05, 0x51, 0xcf, 0x39, 0xc6, 0xdf, 0x6d,
+    0x0d, 0x6f, 0x15, 0x07, 0x79, 0x2e, 0xe3, 0xae, 0x33, 0xbf, 0xfd, 0xba,
+    0x1a, 0x2d, 0x22, 0x4e, 0x3a, 0x0d, 0x45, 0xc8, 0xcb, 0x83, 0xcc, 0x21,
+    0x4a, 0xd2, 0x71, 0xf6, 0x1a, 0xef, 0x6c, 0x68, 0x84, 0xaa, 0x06, 0xad,
+    0x07, 0xf1, 0x05, 0x9b, 0xae, 0xb4, 0x20, 0xd8, 0x68, 0x9c, 0x04, 0x19,
+    0xa6, 0x99, 0x56, 0x2f, 0xd7, 0x87, 0x27, 0x2c, 0x5c, 0x76, 0x63, 0xba,
+    0x3a, 0x3c, 0x34, 0x72, 0xad, 0xf7, 0x53, 0xa4, 0x39, 0x1f, 0xd7, 0xb3,
+    0x28, 0x13, 0x7c, 0xdb, 0x91, 0x97, 0xc5, 0x7b, 0x9d, 0xf4, 0xb2, 0xb2,
+    0x34, 0x5a, 0x28, 0x6b, 0x78, 0x3c, 0x22, 0xb0, 0xfa, 0x61, 0xe6, 0x7f,
+    0xb8, 0x6a, 0xe0, 0xe0, 0x54, 0x92, 0x4e, 0xaf, 0x22, 0x79, 0x2a, 0x1f,
+    0xee, 0xd9, 0x82, 0x53, 0x3e
+};
+static const uint8_t v15_cipher[] = {
+    0xbd, 0x8c, 0x5d, 0xed, 0x85, 0x68, 0x31, 0x21, 0xd0, 0x3e, 0x95, 0xf3,
+    0x3b, 0x60, 0xcd, 0x90, 0xae, 0x83, 0x70, 0x8f, 0xb4, 0x2b, 0x45, 0xbe,
+    0x49, 0x19, 0x10, 0x6f, 0x99, 0x3c, 0x82, 0x74, 0x20, 0x41, 0x23, 0xc8,
+    0x99, 0x62, 0xc0, 0x8e, 0xa4, 0x49, 0xa2, 0x90, 0x8c, 0x77, 0x98, 0x25,
+    0x87, 0xd8, 0xc9, 0xf2, 0x4d, 0x3a, 0xb5, 0x6c, 0x9a, 0xb2, 0xa2, 0xb0,
+    0xc2, 0x26, 0x32, 0x08, 0xe0, 0x88, 0x6e, 0xe9, 0x42, 0xa3, 0xbd, 0x74,
+    0xf3, 0xe8, 0xdf, 0x33, 0xeb, 0x17, 0x25, 0x19, 0xc9, 0x69, 0xb3, 0x20,
+    0x6d, 0x72, 0x21, 0xce, 0x7e, 0x58, 0x10, 0x14, 0xc8, 0x6e, 0xfa, 0x5f,
+    0x61, 0x16, 0x71, 0x3f, 0xac, 0xcd, 0xc4, 0xca, 0x80, 0xc5, 0x58, 0x44,
+    0x4f, 0x0b, 0x35, 0xf6, 0x12, 0x43, 0xf0, 0xb0, 0xd6, 0x61, 0x71, 0x3a,
+    0xe6, 0xbd, 0x03, 0x5d, 0xa8, 0xfa, 0x97, 0xaa, 0x2f, 0x82, 0xbb, 0xee,
+    0x50, 0x87, 0x96, 0x27, 0x95, 0x58, 0xf7, 0x84, 0x02, 0xd6, 0x0c, 0x0f,
+    0x79, 0x90, 0xa1, 0xe1, 0x2a, 0xe5, 0x51, 0xa1, 0x9c, 0x64, 0x3e, 0xc7,
+    0xc7, 0xad, 0x84, 0x26, 0xac, 0x7e, 0xb5, 0x6b, 0xbe, 0xaf, 0x33, 0xcd,
+    0xd1, 0xbe, 0xdd, 0x13, 0xe2, 0x13, 0x13, 0x35, 0xd5, 0x49, 0xb7, 0xbc,
+    0x0d, 0x6e, 0x19, 0x9e, 0xfa, 0x6f, 0x15, 0x6f, 0x62, 0x63, 0x9d, 0xc9,
+    0x3f, 0x1f, 0x1f, 0x5a, 0x38, 0x2d, 0x95, 0x67, 0x77, 0x8f, 0xc5, 0xcc,
+    0x96, 0x14, 0xcd, 0xbe, 0x36, 0xa6, 0xc4, 0x3b, 0x17, 0x4a, 0x2f, 0x54,
+    0x29, 0x22, 0x57, 0x18, 0x25, 0xba, 0xf0, 0x22, 0xfd, 0xcd, 0xd2, 0x59,
+    0xc0, 0x36, 0x57, 0x02, 0x4a, 0xe3, 0xeb, 0xce, 0x50, 0x26, 0x0b, 0x4f,
+    0x58, 0x47, 0x2e, 0xa7, 0x64, 0x65, 0xb0, 0xbb, 0x4a, 0x70, 0x1e, 0x4d,
+    0x52, 0xdd, 0xe7, 0x5c, 0x01, 0x16, 0x70, 0x82, 0x2a, 0x5d, 0xcf, 0x7c,
+    0xf8, 0xcb, 0x86, 0x93, 0x1e, 0xa8, 0x68, 0x7e, 0x4c
+};
+
+static const uint8_t v16_ad[] = {
+    0x4e
+};
+static const uint8_t v16_plain[] = {
+    0xf5, 0xb6, 0xe8, 0x57, 0x58, 0xf0, 0xe7, 0xe7, 0x74, 0x58, 0xe9, 0xea,
+    0x29, 0xff, 0xf2, 0x6d, 0x39, 0x09, 0x61, 0x27, 0x4f, 0x78, 0x6b, 0x0f,
+    0x03, 0xbb, 0xbb, 0x4a, 0x88, 0xdc, 0xb4, 0x1a, 0xcb, 0xba, 0xdc, 0x76,
+    0x27, 0x96, 0x53, 0xe0, 0xba, 0xcd, 0x68, 0xba, 0xa8, 0xfb, 0xd2, 0x47,
+    0x7c, 0x0b, 0x00, 0xeb, 0x86, 0x3a, 0x26, 0xc3, 0x35, 0x52, 0xfc, 0xc8,
+    0x36, 0xa2, 0x58, 0xda, 0xfc, 0xa6, 0x7b, 0x0a, 0x04, 0xe4, 0xfa, 0x81,
+    0x14, 0xf5, 0xc0, 0xdc, 0x63, 0x93, 0x21, 0x50, 0xaa, 0xfc, 0x17, 0x42,
+    0x74, 0x67, 0x87, 0xa0, 0x7c, 0x82, 0xa0, 0xb7, 0x7e, 0xc1, 0xfd, 0x7f,
+    0x4a, 0x89, 0x98, 0x16, 0xd7, 0xea, 0xba, 0xfe, 0x6b, 0x04, 0x3c, 0xd7,
+    0x1c, 0xe8, 0x40, 0xa2, 0xf4, 0x94, 0xde, 0x79, 0xbe, 0xb1, 0xff, 0x9b,
+    0x0f, 0xe5, 0x33, 0x23, 0xf1, 0x99, 0x86, 0xf3, 0xa0, 0x6a, 0x99, 0x76,
+    0x0a, 0xc2, 0x85, 0xfc, 0x2a, 0xde, 0x23, 0xef, 0x56, 0xbe, 0x94, 0x42,
+    0xf7, 0x98, 0xa1, 0xcb, 0xb6, 0x4f, 0x7f, 0x11, 0x5b, 0xec, 0xf6, 0xb7,
+    0x7c, 0x89, 0x24, 0x9d, 0x2f, 0x40, 0xf4, 0x5a, 0xad, 0x2c, 0x92, 0x8a,
+    0xc8, 0xa2, 0x3a, 0x80, 0xc5, 0x15, 0xd6, 0x12, 0x9d, 0x66, 0x63, 0xfb,
+    0xd6, 0xef, 0xc9, 0xb5, 0x67, 0x73, 0xa1, 0xb9, 0xcf, 0xef, 0x08, 0x72,
+    0x31, 0xae, 0x38, 0x61, 0x89, 0x4c, 0x87, 0xf2, 0x6d, 0x3a, 0x3a, 0x23,
+    0xc4, 0x6b, 0x15, 0xe6, 0xa6, 0xf7, 0xaf, 0x77, 0xc9, 0x1b, 0xf7, 0x8c,
+    0x6f, 0xbc, 0x24, 0x5e, 0xdd, 0x08, 0x4c, 0x11, 0xf7, 0xdf, 0x9e, 0x32,
+    0x63, 0xfd, 0xd1, 0xd7, 0x76, 0x2e, 0xad, 0x9e, 0x65, 0x74, 0x92, 0x72,
+    0xd9, 0x4f, 0x20, 0x3d, 0xdc, 0xf0, 0x8f, 0xf2, 0x3a, 0xe7, 0x39, 0x8e,
+    0xab, 0xf0, 0xd1, 0xb2, 0x5f, 0x6f, 0x38, 0x35, 0x30, 0x44, 0x11, 0x7c,
+    0x18, 0x7c, 0x5f, 0xcc, 0x00, 0x2e, 0xb1, 0x13, 0x75, 0x04, 0xf0, 0x8c,
+    0xae, 0xdd, 0x88, 0x54, 0xc2, 0xc4, 0x46, 0xf1, 0x60, 0xc0, 0xc9, 0xbe,
+    0xd2, 0x7b, 0xa9, 0x95, 0x07, 0xae, 0x78, 0xe7, 0x59, 0xcb, 0xff, 0x12
+};
+static const uint8_t v16_cipher[] = {
+    0xa8, 0xac, 0xe2, 0x0d, 0x03, 0x3f, 0xbe, 0x70, 0x70, 0xdf, 0x43, 0x3c,
+    0x40, 0x2e, 0x46, 0x0c, 0xf4, 0x83, 0xb8, 0xbc, 0x38, 0x5b, 0x27, 0xce,
+    0xc6, 0x08, 0x94, 0x1d, 0x45, 0x31, 0x4a, 0xac, 0x52, 0x09, 0x9a, 0x0a,
+    0x4f, 0xbf, 0xfa, 0x2f, 0xd8, 0x62, 0x00, 0x72, 0x3d, 0x20, 0xe0, 0xde,
+    0x79, 0x19, 0x81, 0x3e, 0x58, 0x9f, 0xab, 0x04, 0x29, 0x42, 0xd9, 0xf0,
+    0x84, 0x6d, 0x8c, 0xb9, 0x03, 0xd6, 0x67, 0x29, 0x0b, 0xf8, 0x3b, 0x36,
+    0xa4, 0xfe, 0xd7, 0xb8, 0x72, 0x41, 0x92, 0x08, 0x9c, 0xd9, 0x41, 0x8d,
+    0x2f, 0x15, 0xe4, 0x06, 0xbc, 0xf7, 0xca, 0x27, 0x73, 0x76, 0xc6, 0xcf,
+    0xc4, 0xf9, 0xe7, 0x8a, 0x51, 0xd5, 0x6a, 0x7d, 0x04, 0x5c, 0x67, 0xee,
+    0x64, 0xa7, 0xc0, 0xa8, 0x34, 0x33, 0xf7, 0xed, 0xc9, 0x1f, 0x61, 0x7b,
+    0x57, 0xfd, 0xd4, 0x96, 0x21, 0xde, 0x09, 0x13, 0x97, 0x7c, 0x21, 0xe2,
+    0xcc, 0x92, 0x3b, 0x49, 0x2e, 0x5d, 0x64, 0x2e, 0x87, 0x0f, 0x28, 0x73,
+    0xdf, 0x4a, 0x8b, 0xf7, 0xad, 0x60, 0x73, 0x2a, 0x68, 0x70, 0xd8, 0xea,
+    0x2a, 0x0f, 0xa4, 0xfc, 0x97, 0xac, 0x31, 0xa8, 0x32, 0xc3, 0x82, 0xbd,
+    0x0f, 0x4b, 0xaa, 0xd8, 0x2d, 0x4f, 0xc5, 0x05, 0xa5, 0x65, 0x31, 0x5b,
+    0xd3, 0x74, 0x5e, 0xbb, 0x05, 0x0f, 0xee, 0x40, 0xf2, 0xef, 0x0e, 0x2c,
+    0x7e, 0x08, 0x53, 0x1d, 0xe4, 0xae, 0x17, 0x48, 0x17, 0x0f, 0x97, 0xec,
+    0xd1, 0x75, 0x44, 0x74, 0x03, 0x71, 0x1a, 0x7b, 0xbc, 0xb2, 0x13, 0xa2,
+    0xc4, 0x08, 0x52, 0x0d, 0x17, 0xa4, 0xe5, 0xe1, 0x69, 0x1b, 0xbe, 0x06,
+    0x45, 0xd0, 0x9e, 0x24, 0xcf, 0xd3, 0xbc, 0x07, 0x47, 0x1a, 0xf4, 0xe3,
+    0xc7, 0x55, 0x9d, 0x2b, 0xb9, 0x19, 0xa5, 0x7b, 0x57, 0xf6, 0x82, 0xfc,
+    0x29, 0xf2, 0xa4, 0x49, 0x90, 0x78, 0xf9, 0xcb, 0xd5, 0x62, 0xe4, 0x35,
+    0x38, 0x6a, 0x36, 0xae, 0x9c, 0x8f, 0x4d, 0xe5, 0x4f, 0x92, 0xf1, 0x4a,
+    0x75, 0x9e, 0xdf, 0x81, 0x23, 0xe7, 0x47, 0x1f, 0x5e, 0x69, 0xc0, 0x80,
+    0xaf, 0x63, 0xf1, 0x87, 0x60, 0x1e, 0x45, 0xa6, 0xc3, 0x4e, 0x0d, 0x9f,
+    0xcf, 0x40, 0x64, 0x6c, 0xf9, 0x6e, 0xa9, 0x77, 0xbc, 0xb9, 0x81, 0xb2,
+    0xd5, 0x70, 0x4a, 0x74
+};
+
+static const uint8_t v17_ad[] = {
+    0xff, 0xed, 0x15, 0x93, 0xea, 0x77, 0x38, 0xc3, 0xda, 0x18, 0x60, 0x5e
+};
+static const uint8_t v17_plain[] = {
+    0x3f, 0x33, 0x0e, 0x11, 0x4b, 0x71, 0x37, 0x92, 0xc9, 0x1d, 0xeb, 0x1e,
+    0x17, 0x1f, 0x47, 0xa8, 0x18, 0xcd, 0xcc, 0x92, 0x9a, 0xc9, 0x55, 0x88,
+    0xe1, 0x00, 0xba, 0x51, 0xf5, 0x1b, 0xcb, 0x7d, 0x0b, 0x4a, 0x85, 0xed,
+    0xb5, 0x82, 0xd2, 0x0b, 0xad, 0x29, 0x36, 0x44, 0x9d, 0x4d, 0x49, 0xb8,
+    0x97, 0x47, 0xb7, 0xf1, 0xd7, 0x8b, 0x4e, 0x37, 0xe3, 0xb8, 0xce, 0x59,
+    0xf9, 0xd5, 0x10, 0x79, 0x0a, 0x18, 0xe8, 0x8f, 0x7a, 0x9e, 0xca, 0x4a,
+    0xa8, 0xf1, 0x74, 0x57, 0x8a, 0xf7, 0xdd, 0x51, 0x28, 0x38, 0x60, 0x9d,
+    0x39, 0xdf, 0x24, 0xfd, 0xc5, 0xc8, 0xb4, 0x73, 0x11, 0xbc, 0xdd, 0x21,
+    0xbb, 0xe0, 0x89, 0xee, 0xde, 0xe5, 0x9b, 0x18, 0x99, 0x30, 0x9c, 0x2b,
+    0xde, 0x66, 0x9f, 0x90, 0x30, 0x89, 0x3d, 0x74, 0xd8, 0x82, 0x59, 0xf0,
+    0xc0, 0x7a, 0xee, 0x08, 0x8b, 0xef, 0x06, 0xb8, 0xc8, 0x11, 0xfb, 0xf0,
+    0xa9, 0xeb, 0x0a, 0x2b, 0xc8, 0xd9, 0xab, 0x26, 0x8f, 0x0c, 0x27, 0x69,
+    0x51, 0x91, 0x77, 0x03, 0x0a, 0xce, 0x34, 0xb0, 0x9e, 0xe9, 0xdf, 0xaa,
+    0x91, 0x95, 0xf4, 0x1f, 0xb8, 0x43, 0xc8, 0xf9, 0xa1, 0x26, 0x5a, 0xaa,
+    0x3d, 0xd0, 0x35, 0x49, 0x60, 0xde, 0x37, 0xab, 0x6d, 0xb2, 0xa2, 0xab,
+    0xf9, 0xa6, 0x85, 0x15, 0x5f, 0x84, 0x5a, 0xc7, 0x26, 0x93, 0x29, 0xba,
+    0xf7, 0xe0, 0x9b, 0x54, 0x43, 0x43, 0xcb, 0xd4, 0x67, 0x6a, 0xab, 0x24,
+    0x53, 0x3c, 0x33, 0x0c, 0xb8, 0x7c, 0x0a, 0x0e, 0xa2, 0xb2, 0xe8, 0x66,
+    0xc9, 0x80, 0xff, 0x8a, 0x03, 0x04, 0x73, 0x8e, 0xb6, 0x5d, 0xee, 0x77,
+    0x65, 0xea, 0x8b, 0x1a, 0xd0, 0x55, 0x5c, 0xb9, 0x5d, 0x1f, 0xc0, 0x2e,
+    0x8d, 0xea, 0xb9, 0xf5, 0x50, 0xc6, 0xb9, 0x23, 0xb3, 0x5a, 0x53, 0xed,
+    0xe9, 0x3a, 0xaa, 0xf1, 0xf9, 0xb0, 0x6d, 0xe7, 0xb2, 0x83, 0x57, 0x66,
+    0x7d, 0xc0, 0x2b, 0x7b, 0xf8, 0xb9, 0x60, 0x5d, 0x5b, 0x97, 0x1c, 0x94,
+    0xf8, 0x11, 0x54, 0x63, 0xa1, 0xdc, 0x5d, 0x26, 0x09, 0x52, 0x1d, 0x18,
+    0xfd, 0xa4, 0x36, 0xa1, 0x3f, 0xa3, 0xef, 0xe5, 0xdf, 0x81, 0x4d, 0xf1,
+    0x47, 0x15, 0x6d, 0x51, 0x16, 0xbf, 0x7a, 0x5a, 0xb6, 0x10, 0x7a, 0x4f,
+    0x9a, 0xa6, 0xf4, 0x70, 0x34, 0x7e, 0x7e, 0xd7, 0xf2, 0x43, 0x1e, 0xad,
+    0x26, 0xed, 0x1a, 0xd3, 0xae, 0x29, 0x28, 0x65, 0x1c, 0xbb, 0x7a, 0xbe,
+    0x17, 0x0a, 0x4f, 0xc9, 0xcd, 0x90, 0x3d, 0x20, 0xe2, 0xbb, 0x58, 0xc4,
+    0x70, 0x63, 0xdb, 0x4b, 0xf5, 0xec, 0x97, 0x20, 0x4c, 0xeb, 0x1b, 0xfa,
+    0x15, 0x5f, 0x15, 0x35, 0x44, 0x83, 0xcc, 0xc0, 0x99, 0xbe, 0x45, 0x64,
+    0xc4, 0x99, 0xf0, 0x97, 0x04, 0x0a, 0xff, 0x0d, 0x52, 0x6c, 0xe2, 0xc8,
+    0x02, 0x80, 0xf2, 0x65, 0xea, 0x36, 0xd5, 0xa3, 0x7f, 0xd6, 0xd0, 0xc1,
+    0x9e, 0xe7, 0x71, 0xca, 0x44, 0xe1, 0x39, 0x09, 0x10, 0x27, 0x71, 0x8a,
+    0x24, 0x9f, 0x5a, 0x34, 0xd0, 0x88, 0x9f, 0x01, 0x06, 0xf0, 0xf4, 0x5e,
+    0xcd, 0x38, 0x1c, 0x3f, 0x25, 0x92, 0xbc, 0x4f, 0x08, 0x5d, 0x67, 0x48,
+    0xf2, 0xe8, 0x2c, 0x3d, 0x69, 0x0a, 0xaa, 0xed, 0x5c, 0xb1, 0xb3, 0x77,
+    0xcf, 0x2e, 0x6e, 0x48, 0x72, 0x6f, 0x90, 0xce, 0x7f, 0xb8, 0x98, 0xa6,
+    0xef, 0x70, 0x07, 0xd7, 0xc7, 0x23, 0xfd, 0x14, 0x78, 0x9c, 0x28, 0x02,
+    0x89, 0x97, 0xae, 0x89, 0x10, 0x62, 0x74, 0x9e, 0x15, 0x2c, 0x66, 0x83,
+    0xe0, 0x37, 0x56, 0x07, 0xab, 0x35, 0xf5, 0x09, 0xa4, 0x01, 0x75, 0x63,
+    0x73, 0x5c, 0x5e, 0xac, 0xed, 0x2a, 0x24, 0x47, 0x64, 0x82, 0xd0, 0x51,
+    0x3f, 0x21, 0x87, 0x32, 0x7a, 0xbf, 0x0a, 0x4a, 0x22, 0x99, 0x54, 0x21,
+    0xfd, 0x63, 0x15, 0x78, 0xd2, 0x61, 0x99, 0xa1, 0xd8, 0x66, 0x76, 0x19,
+    0x8f, 0x41, 0x2f, 0xeb, 0x57, 0xc0, 0x4a, 0xa5, 0x10, 0x74, 0xb8, 0x38,
+    0x97, 0x11, 0xdd, 0xae, 0xf6, 0x5b, 0xfa, 0x8f, 0xfc, 0xae, 0x2e, 0x60,
+    0x9c, 0x68, 0x42, 0xbf, 0xc8, 0xa7, 0xe3, 0xd4, 0xfe, 0x6e, 0x58, 0x69,
+    0x68, 0x6b, 0xd4, 0x28, 0x9a, 0xcc, 0xbc, 0x65, 0x23, 0xe1, 0xe0, 0x8a,
+    0xaa, 0x2d, 0x22, 0xa7, 0xc1, 0x8d, 0x1a, 0xd6, 0xfa, 0xfc, 0x1a, 0xfd,
+    0xfd, 0xc5, 0xfc, 0x8d, 0xed, 0x95, 0x7e, 0xaa, 0x39, 0x48, 0xd5, 0x2e,
+    0xf2, 0xf8, 0xb2, 0x1a, 0x89, 0x20, 0xb4, 0xce, 0xd2, 0x30, 0x35, 0x0c,
+    0x8d, 0x33, 0xd0, 0x6e, 0xbc, 0xd6, 0x4b, 0xa2, 0xf3, 0xe4, 0xc5, 0x2b,
+    0xc2, 0x7d, 0xf2, 0x51, 0x8c, 0xb0, 0xfc, 0x87, 0xae, 0x2f, 0x07, 0x33,
+    0x48, 0x8e, 0x69, 0x93, 0xf2, 0xa8, 0xd1, 0x19, 0x3a, 0x87, 0xed, 0xac,
+    0x7d, 0xda, 0x05, 0x9c, 0x79, 0x99, 0x65, 0x0f, 0x4e, 0x45, 0xfd, 0x5d,
+    0x63, 0xe3, 0xb8, 0x14, 0x82, 0x8b, 0x51, 0x29, 0xce, 0x30, 0xd7, 0xcd,
+    0x9d, 0x2e, 0x7a, 0xd4, 0xf8, 0x38, 0xd2, 0xfa, 0xe8, 0xe8, 0xa1, 0xad,
+    0xa7, 0x4e, 0x70, 0xa9, 0xec, 0x8c, 0x07, 0x40, 0xb4, 0xd3, 0x86, 0xc9,
+    0x11, 0xe8, 0xc9, 0x97, 0xcc, 0x42, 0x74, 0x05, 0x55, 0xb6, 0x78, 0x4a,
+    0x0a, 0xff, 0xfb, 0xb8, 0xd6, 0xfb, 0xd6, 0xf4, 0x48, 0x74, 0xad, 0x56,
+    0xdd, 0x1c, 0xc7, 0xdb, 0xfa, 0xf6, 0x28, 0x23, 0xcf, 0x48, 0x75, 0xfe,
+    0x7b, 0x3c, 0xcc, 0xc6, 0xf7, 0x2f, 0x5c, 0x36, 0xc4, 0xbe, 0x71, 0x35,
+    0x06, 0xca, 0x52, 0x0e, 0xfb, 0x9e, 0x8c, 0x3d, 0xc3, 0x78, 0xc9, 0xf2,
+    0x3f, 0xb4, 0x53, 0xe8, 0xe4, 0x4a, 0x9a, 0xaa, 0x72, 0x67, 0xd1, 0x39,
+    0x91, 0xb8, 0x96, 0x17, 0x3e, 0xc2, 0x94, 0xfe, 0x32, 0x76, 0x62, 0xc1,
+    0x1b, 0x88, 0xe4, 0x86, 0x01, 0xb1, 0xcc, 0xbd, 0x35, 0x12, 0xbf, 0x28,
+    0x48, 0x60, 0x3c, 0xb4, 0x14, 0xa5, 0x8a, 0xa4, 0xb3, 0x72, 0x33, 0xe2,
+    0xe2, 0x74, 0x82, 0xed, 0xa2, 0x0b, 0x55, 0xba, 0xee, 0xad, 0x2f, 0x4c,
+    0xae, 0x27, 0x42, 0x87, 0x44, 0xf5, 0x47, 0x4e, 0x7c, 0x9b, 0x73, 0x1a,
+    0xe2, 0xaa, 0x76, 0xc6, 0xe8, 0xb2, 0xd4, 0x72, 0x05, 0x1f, 0xab, 0x14,
+    0xb7, 0xef, 0x71, 0x2b, 0xcb, 0xd3, 0x06, 0xb1, 0x98, 0xa0, 0xe0, 0xa0,
+    0x2e, 0xfa, 0xa6, 0x3e, 0x61, 0xc6, 0x86, 0x24, 0xaf, 0x7f, 0x6d, 0x42,
+    0xcb, 0x32, 0xd8, 0x2e, 0x76, 0x17, 0xa5, 0xd1, 0xb3, 0xed, 0x24, 0x17,
+    0x1c, 0xd4, 0x77, 0x95, 0x61, 0xa2, 0x14, 0x6f, 0x0d, 0x49, 0x46, 0x1a,
+    0x8b, 0x9d, 0xf8, 0x35, 0xd7, 0xe5, 0x9b, 0x95, 0x95, 0xcb, 0x8d, 0x9a,
+    0x55, 0x12, 0x0a, 0xc1, 0x35, 0xe8, 0x84, 0xa9, 0xbf, 0x43, 0xe9, 0x25,
+    0x9d, 0xff, 0x05, 0xc3, 0x45, 0xe8, 0x45, 0x85, 0x45, 0x75, 0xc4, 0x04,
+    0x9b, 0xb9, 0xf8, 0x43, 0x4c, 0xf1, 0x10, 0xd6, 0x2d, 0xfc, 0x50, 0x0e,
+    0x29, 0xa3, 0x05, 0x2f, 0x4c, 0x81, 0x00, 0xc3, 0xfe, 0x6a, 0x04, 0xa2,
+    0x19, 0x53, 0x58, 0xba, 0xdd, 0x77, 0x4c, 0x8f, 0x13, 0xe8, 0xdf, 0xd8,
+    0x15, 0x56, 0x9d, 0x47, 0x6b, 0x73, 0x47, 0x7d, 0xe0, 0xeb, 0x88, 0x43,
+    0x40, 0x2b, 0x60, 0x5a, 0x7d, 0x15, 0x08, 0xae, 0xe9, 0x1c, 0x24, 0xb7,
+    0x6f, 0x15, 0x02, 0x98, 0xf7, 0xf5, 0x92, 0x42, 0x51, 0xd8, 0xe1, 0x8c,
+    0xa4, 0xf3, 0x78, 0x49
+};
+static const uint8_t v17_cipher[] = {
+    0xf8, 0xd7, 0xc4, 0x77, 0xce, 0xc2, 0x26, 0xa6, 0x5d, 0x23, 0xff, 0xe6,
+    0x93, 0xb5, 0x04, 0xff, 0x21, 0x0e, 0xb9, 0x95, 0x98, 0x3a, 0x06, 0xc2,
+    0x66, 0xd3, 0xc2, 0xe7, 0x7a, 0x78, 0xaa, 0xd4, 0x8c, 0x39, 0x5e, 0x8b,
+    0x6a, 0xb0, 0xe2, 0x88, 0x31, 0x99, 0xf5, 0x71, 0xba, 0xea, 0xee, 0x16,
+    0x5b, 0xcb, 0xde, 0xba, 0xff, 0x0f, 0xb5, 0x7f, 0xfc, 0x4f, 0x90, 0xbc,
+    0x32, 0xb2, 0x09, 0xc8, 0xed, 0x4f, 0xa6, 0x5e, 0x5f, 0x8b, 0x9f, 0xd2,
+    0xd6, 0x41, 0x96, 0x1b, 0xec, 0x15, 0xf2, 0x2a, 0x4f, 0x9a, 0xa0, 0x70,
+    0xee, 0x6b, 0x1c, 0xf8, 0x95, 0x2e, 0x4d, 0x73, 0x39, 0x66, 0x88, 0x76,
+    0xa2, 0xdc, 0xb0, 0x26, 0x70, 0x91, 0x67, 0xf2, 0x28, 0x54, 0x3d, 0x61,
+    0x67, 0x92, 0x2f, 0x56, 0xff, 0x6a, 0xf5, 0xd7, 0x3d, 0x62, 0xb5, 0x94,
+    0x57, 0x4d, 0xe6, 0xbf, 0x47, 0x1c, 0x84, 0xa0, 0x29, 0x1e, 0x89, 0x34,
+    0x96, 0x32, 0x13, 0xc0, 0xb4, 0xb6, 0xe6, 0xe8, 0x02, 0x5e, 0x1b, 0x6b,
+    0xd6, 0x7d, 0xd1, 0x02, 0x58, 0x6b, 0x79, 0x5c, 0x1d, 0x9e, 0xdc, 0xab,
+    0x74, 0x60, 0xde, 0xcb, 0xab, 0xc8, 0x00, 0x8e, 0x3b, 0x9d, 0x29, 0xb8,
+    0x61, 0xaf, 0x77, 0xf4, 0x29, 0x42, 0x82, 0x58, 0xfd, 0x0e, 0xb5, 0xb1,
+    0xbf, 0x08, 0x11, 0xe3, 0x92, 0xfe, 0x63, 0x7e, 0x72, 0x40, 0xc6, 0xc9,
+    0x9b, 0x00, 0xac, 0x6b, 0x0f, 0x24, 0xdd, 0x57, 0xc1, 0x24, 0x5c, 0xee,
+    0x6d, 0x4d, 0x93, 0x8c, 0x4d, 0xa2, 0x9a, 0x1a, 0xab, 0xb0, 0xdd, 0x09,
+    0xef, 0x1e, 0xd1, 0xd0, 0xcb, 0x32, 0x88, 0xc6, 0xd0, 0xae, 0x80, 0x40,
+    0x2f, 0x37, 0xee, 0x4d, 0xea, 0x2e, 0x12, 0x9d, 0x0d, 0x7b, 0xdc, 0xec,
+    0xed, 0xf4, 0xa8, 0x3a, 0x14, 0x9b, 0xc2, 0x5d, 0x7c, 0x75, 0x11, 0x01,
+    0xcd, 0x5a, 0x4b, 0x41, 0xa1, 0x67, 0x95, 0x28, 0x58, 0xf7, 0x9b, 0x21,
+    0x7f, 0x04, 0xd9, 0x39, 0x5e, 0xf2, 0xef, 0xb6, 0x92, 0x9b, 0x0f, 0x39,
+    0x0a, 0xbf, 0x6f, 0xd8, 0x13, 0x3e, 0x14, 0x2a, 0x15, 0xc5, 0xea, 0xef,
+    0x67, 0xf9, 0xa9, 0x83, 0xa6, 0xbe, 0x97, 0xdc, 0x29, 0x50, 0x6b, 0xe9,
+    0xef, 0x31, 0x0c, 0xa2, 0xcb, 0x07, 0xbf, 0x5a, 0x46, 0x21, 0x18, 0xa4,
+    0x63, 0xb4, 0xc9, 0x9d, 0xbd, 0x26, 0x21, 0xa0, 0xa3, 0xcd, 0xb6, 0x93,
+    0x1e, 0x50, 0x3b, 0x7a, 0x09, 0xe0, 0x7c, 0xbe, 0x48, 0x7b, 0x06, 0x11,
+    0xa8, 0x8a, 0xec, 0x07, 0x39, 0x46, 0xdf, 0xb6, 0xc7, 0x2d, 0xbf, 0x24,
+    0x2f, 0x63, 0xf3, 0xd9, 0x8f, 0x4e, 0xd6, 0x3e, 0xf9, 0x7c, 0xe2, 0x4b,
+    0x2e, 0xde, 0x02, 0x89, 0xea, 0x55, 0xf6, 0x57, 0xdb, 0xde, 0xe5, 0x28,
+    0xd7, 0x73, 0x43, 0x1f, 0x63, 0xd7, 0x33, 0x90, 0xd5, 0xd8, 0x88, 0x29,
+    0x98, 0x39, 0x36, 0x5b, 0x0c, 0x64, 0x2b, 0x29, 0xb8, 0x3c, 0x28, 0xff,
+    0xab, 0x4f, 0x1f, 0x06, 0xb6, 0x2d, 0xc1, 0x2f, 0x17, 0xd5, 0xa6, 0xa6,
+    0x17, 0xac, 0x64, 0x0e, 0x62, 0x78, 0x74, 0x78, 0x0c, 0xb5, 0xce, 0x0a,
+    0x9b, 0x77, 0x23, 0x29, 0xba, 0xe2, 0x92, 0x2d, 0x3a, 0xe2, 0x03, 0xa7,
+    0x87, 0x48, 0xfb, 0x70, 0xea, 0x4b, 0x4d, 0x4f, 0x8f, 0x80, 0x4f, 0x75,
+    0xf0, 0xf8, 0x9e, 0xad, 0xc9, 0xac, 0x5b, 0x87, 0x90, 0x44, 0x7c, 0x08,
+    0x58, 0x71, 0xc0, 0xad, 0x17, 0x2c, 0x14, 0x98, 0x55, 0x88, 0xbc, 0x65,
+    0x9b, 0x6f, 0x78, 0x51, 0x0f, 0x69, 0x88, 0x2d, 0xbf, 0xc4, 0xdc, 0xad,
+    0x8c, 0xac, 0x3a, 0xa2, 0xe9, 0xba, 0x63, 0x7e, 0xbe, 0xb5, 0xbf, 0x2b,
+    0xe6, 0x1a, 0xb1, 0xa0, 0x2b, 0x57, 0x5f, 0x85, 0x54, 0xdb, 0xd9, 0x6a,
+    0x1e, 0x09, 0xac, 0x79, 0x1e, 0xc2, 0xf6, 0xc9, 0x80, 0x7a, 0x80, 0x87,
+    0x02, 0xf4, 0x6f, 0x62, 0xf5, 0xd1, 0x01, 0x6a, 0x6c, 0xcd, 0xc9, 0x9a,
+    0x60, 0x28, 0xd8, 0xe2, 0x0d, 0x3e, 0x7b, 0xc0, 0xad, 0x05, 0x18, 0xf6,
+    0xf2, 0x97, 0x02, 0x53, 0x63, 0x8e, 0x8a, 0x05, 0x39, 0xd5, 0xa9, 0x5b,
+    0x19, 0xe6, 0xd3, 0x83, 0xbb, 0x13, 0x70, 0xe8, 0x53, 0x64, 0xc2, 0xb4,
+    0x3c, 0x61, 0x4c, 0xc3, 0x31, 0x08, 0x71, 0xab, 0xa3, 0xe8, 0xc2, 0x82,
+    0x39, 0x4e, 0x60, 0xef, 0x22, 0x6f, 0x90, 0x95, 0xec, 0xe5, 0xda, 0x7f,
+    0xd7, 0x29, 0xa7, 0x72, 0xf7, 0x6c, 0x2a, 0xa7, 0x3a, 0xb6, 0x36, 0x9e,
+    0xd5, 0x86, 0xc6, 0x62, 0xb0, 0x15, 0x0f, 0x80, 0x76, 0x51, 0x2f, 0x8a,
+    0xc0, 0xb1, 0x01, 0x1b, 0xea, 0xab, 0x20, 0xa8, 0xa2, 0x20, 0x34, 0x4c,
+    0x3b, 0x5e, 0xe6, 0x20, 0xb9, 0xe6, 0x68, 0xd1, 0xfc, 0xf4, 0x04, 0xd6,
+    0x8d, 0xf0, 0x4b, 0x77, 0x54, 0x60, 0xa1, 0xf8, 0x8f, 0x64, 0xfa, 0xd0,
+    0xfd, 0xe6, 0x4a, 0x70, 0x42, 0x01, 0xac, 0xb1, 0x65, 0xa9, 0x07, 0x28,
+    0x40, 0xf6, 0x6e, 0xdb, 0xb8, 0x2a, 0x00, 0xe9, 0x6f, 0xc1, 0x1b, 0xe4,
+    0xdc, 0x9d, 0x64, 0x32, 0xde, 0x3e, 0x82, 0xa3, 0x88, 0x77, 0xbf, 0x4c,
+    0x9d, 0x82, 0xe4, 0x34, 0xf0, 0x9f, 0x09, 0x68, 0xb5, 0xf3, 0xa5, 0xd0,
+    0xe3, 0x54, 0xd2, 0x8a, 0x24, 0x0a, 0x4c, 0x54, 0xb1, 0xa2, 0x39, 0xc0,
+    0x26, 0x15, 0x27, 0xb5, 0x16, 0x10, 0xe2, 0x11, 0x8a, 0x1f, 0xbe, 0x89,
+    0x10, 0xb7, 0xf7, 0xee, 0x0d, 0x2b, 0x9a, 0xe2, 0x32, 0xdf, 0x25, 0x03,
+    0x92, 0x48, 0x19, 0xa7, 0x44, 0xd2, 0x4f, 0x02, 0xb4, 0x5d, 0x85, 0x42,
+    0x10, 0x82, 0x99, 0x62, 0x8f, 0x92, 0x85, 0x4c, 0x21, 0xe9, 0xa5, 0x8c,
+    0x98, 0xfc, 0x83, 0x53, 0x86, 0xa8, 0x0e, 0xd9, 0x63, 0xdf, 0x56, 0x5f,
+    0xb0, 0xe7, 0xa1, 0xbd, 0x9a, 0xee, 0x32, 0x3e, 0xeb, 0x01, 0xd7, 0x37,
+    0x02, 0xc8, 0x16, 0xd8, 0x9f, 0x01, 0x66, 0x4d, 0x38, 0x79, 0x66, 0x2f,
+    0x1e, 0x48, 0x27, 0x06, 0xeb, 0x54, 0x72, 0xb3, 0x1d, 0x4b, 0x52, 0x68,
+    0x6e, 0x66, 0xc2, 0x99, 0xad, 0x34, 0x2c, 0x04, 0xa3, 0xd9, 0x7c, 0xf0,
+    0x16, 0x24, 0x55, 0x07, 0x7f, 0xfe, 0x49, 0x8c, 0x9b, 0xd2, 0x4f, 0x7b,
+    0x8f, 0x86, 0x74, 0x85, 0xc8, 0x88, 0x39, 0x6e, 0x9c, 0x8b, 0x04, 0x44,
+    0x58, 0x0d, 0x91, 0xa7, 0x85, 0x84, 0xe8, 0x35, 0xcf, 0x73, 0x29, 0xdf,
+    0x86, 0x75, 0x1e, 0xda, 0x4f, 0x0a, 0x2a, 0x4f, 0x31, 0x29, 0x46, 0xfa,
+    0xd4, 0x08, 0x57, 0x67, 0x5d, 0xc8, 0x91, 0xff, 0x1b, 0xc2, 0x6f, 0xc3,
+    0xb1, 0x4a, 0xad, 0xe4, 0x5c, 0x26, 0x60, 0x8b, 0xc4, 0xbf, 0xd8, 0x5e,
+    0x8e, 0x9b, 0xbd, 0x21, 0x3f, 0x11, 0x33, 0xd0, 0x33, 0x77, 0xab, 0x6a,
+    0x40, 0xd0, 0x7a, 0x64, 0xd0, 0x85, 0x3d, 0xd4, 0x65, 0x92, 0x87, 0xc6,
+    0x6a, 0x06, 0xbd, 0x41, 0x65, 0x1b, 0x23, 0x87, 0x48, 0x73, 0xc5, 0x3e,
+    0x0a, 0xbf, 0x84, 0x9c, 0xc1, 0xdb, 0x8b, 0x33, 0x52, 0xf3, 0x77, 0x57,
+    0x3e, 0xab, 0x3f, 0xf9, 0x73, 0x52, 0xab, 0x38, 0xa9, 0x58, 0x91, 0xe2,
+    0x16, 0x73, 0x5e, 0xa6, 0x28, 0xd9, 0x2b, 0x5f, 0xe8, 0xb2, 0xcb, 0x59,
+    0x66, 0x2a, 0x08, 0x28, 0x6f, 0x6f, 0xf5, 0xad, 0x91, 0xca, 0x4d, 0x4e,
+    0x54, 0x94, 0x4d, 0xe8, 0x6a, 0xba, 0xe6, 0xdf, 0x34, 0x10, 0x67, 0x98,
+    0xf3, 0x1c, 0xa1, 0x7b, 0x01, 0x58, 0xec, 0x9f, 0x44, 0xce, 0x9a, 0x6a,
+    0x93, 0x2f, 0xa7, 0xff, 0x77, 0x34, 0x17, 0x3a, 0x5d, 0xe2, 0x8e, 0x25,
+    0x96, 0x0d, 0x1e, 0xb1, 0xea, 0x47, 0xfc, 0x0b
+};
+
+static const rfc8439_vector_t rfc8439_vectors[] = {
+    {
+        {
+            0x4c, 0x87, 0xf6, 0xb4, 0xc5, 0xff, 0x4c, 0xb2, 0xb3, 0xb2, 0x48, 0xb3,
+            0x7e, 0x0b, 0xbc, 0x02, 0x27, 0x3a, 0xdc, 0x7b, 0xe7, 0x2f, 0xa7, 0x0d,
+            0xea, 0x3e, 0x65, 0x7e, 0xee, 0xc0, 0x94, 0x2c
+        },
+        {
+            0x57, 0x6f, 0x03, 0xf7, 0x81, 0x77, 0x62, 0x86, 0x5c, 0x38, 0x1b, 0xbb
+        },
+        0, v0_ad, 0, v0_plain, v0_cipher
+    },
+    {
+        {
+            0xea, 0x5b, 0xfd, 0x4d, 0x7d, 0xe0, 0xd1, 0xac, 0x25, 0x9b, 0x1e, 0x3b,
+            0x8f, 0x10, 0xb9, 0xdd, 0x1d, 0xf3, 0x04, 0xc1, 0xe9, 0x80, 0x4e, 0x42,
+            0x1e, 0xd4, 0xe8, 0x76, 0x3d, 0x36, 0xdb, 0xd3
+        },
+        {
+            0x73, 0xda, 0x90, 0xb5, 0xc6, 0x64, 0x08, 0xf3, 0x64, 0x45, 0x7a, 0x36
+        },
+        1, v1_ad, 1, v1_plain, v1_cipher
+    },
+    {
+        {
+            0x15, 0x54, 0x82, 0x70, 0x3b, 0xb0, 0x69, 0xab, 0xf2, 0x78, 0x75, 0x20,
+            0xbb, 0xd5, 0x68, 0x0c, 0xe4, 0x1b, 0xc5, 0x2f, 0x22, 0x4e, 0x18, 0x83,
+            0x6c, 0x3a, 0xc8, 0x60, 0xb8, 0xcd, 0x76, 0xeb
+        },
+        {
+            0x7c, 0xfe, 0x06, 0x2b, 0x33, 0x4d, 0xcf, 0xb6, 0x98, 0xba, 0x88, 0x5d
+        },
+        12, v2_ad, 15, v2_plain, v2_cipher
+    },
+    {
+        {
+            0x22, 0xcd, 0xfb, 0x35, 0x33, 0xeb, 0x46, 0x8a, 0x42, 0x13, 0xb3, 0x05,
+            0x84, 0xd3, 0xe0, 0x2f, 0x42, 0x2a, 0xd4, 0x11, 0xf0, 0xdf, 0x07, 0x67,
+            0x29, 0xd9, 0xa1, 0x03, 0x55, 0xae, 0xb2, 0x6a
+        },
+        {
+            0xe3, 0xf4, 0xa6, 0x6e, 0x9d, 0x36, 0xfa, 0x86, 0x5d, 0x88, 0xcf, 0x9a
+        },
+        16, v3_ad, 16, v3_plain, v3_cipher
+    },
+    {
+        {
+            0x79, 0x9c, 0xf8, 0xa7, 0x4c, 0x62, 0xa0, 0x68, 0x19, 0x93, 0x41, 0xa2,
+            0x6d, 0x9f, 0x3a, 0x75, 0x2e, 0xf7, 0xf1, 0xf9, 0xe8, 0x04, 0xb2, 0xba,
+            0xd0, 0xd7, 0x06, 0x0c, 0x16, 0x94, 0xda, 0x0c
+        },
+        {
+            0xc6, 0x0f, 0x27, 0x8d, 0xf6, 0xe2, 0x4e, 0x6d, 0x8c, 0xe9, 0x07, 0x9e
+        },
+        17, v4_ad, 17, v4_plain, v4_cipher
+    },
+    {
+        {
+            0x51, 0x7b, 0x27, 0xe2, 0x15, 0xc2, 0x0f, 0x17, 0xcb, 0x56, 0x30, 0x68,
+            0x5d, 0x17, 0x2c, 0x99, 0x24, 0xf0, 0x7b, 0xe5, 0xde, 0xde, 0x16, 0x21,
+            0x87, 0x59, 0x24, 0x35, 0x80, 0x14, 0xeb, 0xb4
+        },
+        {
+            0x9a, 0x33, 0x61, 0x09, 0xd2, 0xdc, 0xec, 0xe4, 0x8c, 0x7b, 0x4e, 0xc6
+        },
+        0, v5_ad, 63, v5_plain, v5_cipher
+    },
+    {
+        {
+            0x5e, 0xfa, 0xd7, 0x5f, 0x8f, 0x00, 0x28, 0xfb, 0x59, 0x14, 0xf4, 0x5c,
+            0x65, 0x5d, 0xbf, 0x2a, 0xb0, 0x0d, 0x48, 0xb1, 0x06, 0x9f, 0xb5, 0xb9,
+            0x4f, 0xa0, 0x19, 0x06, 0xbc, 0x7c, 0x07, 0x7c
+        },
+        {
+            0xcd, 0xa3, 0x2c, 0x8c, 0xbe, 0xcb, 0x79, 0x1a, 0x48, 0xdc, 0xc8, 0x68
+        },
+        1, v6_ad, 64, v6_plain, v6_cipher
+    },
+    {
+        {
+            0x39, 0xad, 0xdf, 0x93, 0x6c, 0x57, 0x72, 0xd1, 0x20, 0x70, 0xf8, 0xc8,
+            0xbc, 0x6c, 0xc8, 0x9a, 0x4b, 0xd4, 0x5f, 0x97, 0x0f, 0xe3, 0x1c, 0x1f,
+            0x75, 0x2e, 0x49, 0x99, 0x0f, 0x85, 0x7d, 0xe6
+        },
+        {
+            0x1e, 0x9e, 0xd9, 0xc5, 0xff, 0xde, 0xe2, 0x68, 0x32, 0x34, 0xa5, 0x45
+        },
+        12, v7_ad, 65, v7_plain, v7_cipher
+    },
+    {
+        {
+            0x3c, 0xbc, 0xc3, 0x35, 0x30, 0x09, 0x52, 0x87, 0x60, 0x28, 0xc4, 0x27,
+            0x94, 0x51, 0x39, 0x77, 0xbb, 0x6f, 0x57, 0x9d, 0xaa, 0xfb, 0xfb, 0x4c,
+            0x99, 0xde, 0xf3, 0x79, 0xb5, 0x41, 0x8a, 0xb3
+        },
+        {
+            0x7d, 0x0f, 0x97, 0xa4, 0x88, 0x79, 0x58, 0x84, 0xf8, 0x75, 0xed, 0xdb
+        },
+        16, v8_ad, 127, v8_plain, v8_cipher
+    },
+    {
+        {
+            0x88, 0x0c, 0x1c, 0xb8, 0x82, 0xfd, 0x6f, 0xa5, 0xa7, 0x4e, 0xfd, 0x63,
+            0xb4, 0x32, 0x5b, 0x55, 0x21, 0xc3, 0xe0, 0x3f, 0x61, 0x96, 0x42, 0x6b,
+            0xa3, 0x19, 0x76, 0xf1, 0x7c, 0x6d, 0xb0, 0x01
+        },
+        {
+            0x7e, 0xe6, 0x2b, 0x8b, 0xf0, 0xae, 0xcf, 0xa1, 0x6c, 0x69, 0xcc, 0x48
+        },
+        17, v9_ad, 128, v9_plain, v9_cipher
+    },
+    {
+        {
+            0xf9, 0x2e, 0x16, 0xa1, 0x09, 0x13, 0x69, 0x27, 0x1f, 0x46, 0x10, 0x30,
+            0x2f, 0x39, 0x4e, 0x53, 0x1e, 0xd9, 0x0c, 0x36, 0x47, 0xf0, 0xc8, 0x93,
+            0x22, 0x24, 0x89, 0xd3, 0xd4, 0x34, 0x16, 0x9e
+        },
+        {
+            0x05, 0x0c, 0x8d, 0x87, 0xd6, 0x92, 0xa2, 0x6c, 0xb9, 0x22, 0xbe, 0x57
+        },
+        0, v10_ad, 129, v10_plain, v10_cipher
+    },
+    {
+        {
+            0xa6, 0x34, 0xb9, 0x3a, 0xd6, 0xa0, 0x58, 0xb9, 0xcd, 0x78, 0xc6, 0x0d,
+            0xab, 0xb3, 0x0d, 0x70, 0x65, 0x92, 0x15, 0x2f, 0x75, 0x36, 0xa1, 0xea,
+            0xba, 0x61, 0x90, 0x15, 0xa0, 0x0e, 0x25, 0x31
+        },
+        {
+            0x77, 0x12, 0xe8, 0x3f, 0x82, 0x1e, 0x8f, 0x5a, 0x73, 0xea, 0x10, 0x9f
+        },
+        1, v11_ad, 191, v11_plain, v11_cipher
+    },
+    {
+        {
+            0xe8, 0xcd, 0xd6, 0x2e, 0x90, 0xba, 0xfe, 0xec, 0x35, 0x85, 0x92, 0x30,
+            0xb9, 0xc2, 0xaf, 0xbc, 0xa7, 0x6c, 0x08, 0xd1, 0xba, 0xae, 0xbb, 0x0c,
+            0x3c, 0x81, 0xc3, 0x42, 0xc6, 0xad, 0xe3, 0x8a
+        },
+        {
+            0x43, 0x79, 0x45, 0xb5, 0x49, 0x4a, 0xcd, 0x41, 0x11, 0x29, 0xc4, 0x17
+        },
+        12, v12_ad, 250, v12_plain, v12_cipher
+    },
+    {
+        {
+            0x04, 0xc6, 0xca, 0x88, 0xab, 0x35, 0x7f, 0x1f, 0x0e, 0x49, 0x98, 0x5a,
+            0x59, 0x9a, 0x60, 0x6b, 0xa4, 0x50, 0xd4, 0x7a, 0xcd, 0xbe, 0x61, 0xa7,
+            0xd1, 0xb6, 0x41, 0x69, 0x40, 0xd6, 0xc3, 0x82
+        },
+        {
+            0x21, 0x1d, 0x9f, 0x4f, 0xc5, 0x94, 0xe4, 0x8c, 0x78, 0xd5, 0xac, 0xc8
+        },
+        16, v13_ad, 255, v13_plain, v13_cipher
+    },
+    {
+        {
+            0xef, 0xce, 0x55, 0xe7, 0xe1, 0xe7, 0x2e, 0x1c, 0x39, 0xa4, 0x08, 0x01,
+            0x6a, 0x14, 0x6b, 0x42, 0xc3, 0x08, 0xdd, 0x47, 0xa9, 0xcf, 0xda, 0x14,
+            0x0c, 0x1b, 0xb8, 0xa6, 0xbe, 0x52, 0x04, 0x40
+        },
+        {
+            0x9d, 0xa0, 0x3b, 0xb4, 0x56, 0x04, 0xa6, 0xe7, 0x91, 0x88, 0x6a, 0x7d
+        },
+        17, v14_ad, 256, v14_plain, v14_cipher
+    },
+    {
+        {
+            0x8f, 0x59, 0xa1, 0xf3, 0x2d, 0x7f, 0x38, 0xb3, 0x96, 0xb6, 0x3a, 0x01,
+            0xc7, 0xd3, 0x46, 0x14, 0xe2, 0xec, 0x20, 0x83, 0xf0, 0x8d, 0x91, 0x2b,
+            0xbf, 0x05, 0x90, 0x03, 0x6d, 0x27, 0xe2, 0x09
+        },
+        {
+            0x9d, 0xd0, 0x6e, 0xe0, 0xd0, 0x66, 0x86, 0xfd, 0xb4, 0x2a, 0x93, 0x78
+        },
+        0, v15_ad, 257, v15_plain, v15_cipher
+    },
+    {
+        {
+            0xce, 0x0d, 0x9e, 0xfa, 0x3d, 0xf3, 0xa1, 0x2e, 0x5a, 0xb6, 0xe0, 0xd3,
+            0x2f, 0x12, 0x3b, 0x4a, 0x72, 0x8c, 0xce, 0x42, 0x11, 0x09, 0x87, 0x5f,
+            0xbf, 0xe2, 0x1c, 0xdd, 0xee, 0xb9, 0x3d, 0x2a
+        },
+        {
+            0x85, 0xa1, 0xbc, 0xa6, 0x28, 0x64, 0xa9, 0x32, 0xde, 0x00, 0xa0, 0x69
+        },
+        1, v16_ad, 300, v16_plain, v16_cipher
+    },
+    {
+        {
+            0x8c, 0x6d, 0x30, 0x88, 0x67, 0x3f, 0xa4, 0xfc, 0x5b, 0x09, 0x06, 0x65,
+            0x1c, 0x75, 0x57, 0x2d, 0x0e, 0x8e, 0x3e, 0x11, 0x1e, 0x7b, 0x1e, 0xa2,
+            0x2b, 0x42, 0xca, 0x15, 0xda, 0x84, 0x9e, 0x0a
+        },
+        {
+            0x48, 0x3e, 0x0d, 0x21, 0xd6, 0x6f, 0x90, 0xfe, 0x9a, 0xed, 0x32, 0x4e
+        },
+        12, v17_ad, 1000, v17_plain, v17_cipher
+    },
+};
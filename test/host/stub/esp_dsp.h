@@ -0,0 +1,34 @@
+#ifndef _HOST_ESP_DSP_H_
+#define _HOST_ESP_DSP_H_
+
+#include <stdint.h>
+
+#include "esp_err.h"
+
+/*
+    Host stand-in for the esp-dsp subset used by app modules. FFTs are
+    plain radix-2 with esp-dsp conventions: forward transform, output
+    in bit reversed order until dsps_bit_rev_*, sc16 scaled by 1/N with
+    a rounded shift per stage, fc32 not scaled. Refer to esp_dsp_host.c
+*/
+
+#define ESP_ERR_DSP_BASE            0x70000
+#define ESP_ERR_DSP_REINITIALIZED   (ESP_ERR_DSP_BASE + 3)
+
+esp_err_t dsps_fft2r_init_sc16(int16_t* fft_table_buff, int table_size);
+esp_err_t dsps_fft2r_sc16(int16_t* data, int N);
+esp_err_t dsps_bit_rev_sc16_ansi(int16_t* data, int N);
+
+esp_err_t dsps_fft2r_init_fc32(float* fft_table_buff, int table_size);
+esp_err_t dsps_fft2r_fc32(float* data, int N);
+esp_err_t dsps_bit_rev_fc32(float* data, int N);
+
+/* Host time stamp counter, not LX7 cycles. Refer to host_os.c */
+uint64_t host_cycle_count(void);
+
+static inline uint32_t dsp_get_cpu_cycle_count(void)
+{
+    return (uint32_t) host_cycle_count();
+}
+
+#endif //_HOST_ESP_DSP_H_
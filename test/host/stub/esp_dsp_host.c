@@ -0,0 +1,126 @@
+#include <math.h>
+
+#include "esp_dsp.h"
+
+/* Decimation in frequency: natural order in, bit reversed order out. */
+
+esp_err_t dsps_fft2r_init_sc16(int16_t* fft_table_buff, int table_size)
+{
+    (void) fft_table_buff;
+    (void) table_size;
+    return ESP_OK;
+}
+
+esp_err_t dsps_fft2r_sc16(int16_t* data, int N)
+{
+    for (int half = N / 2; half > 0; half /= 2)
+    {
+        for (int k = 0; k < half; k++)
+        {
+            double a = -2.0 * M_PI * k / (2 * half);
+            int32_t c = lrint(fmin(cos(a) * 32768.0, 32767.0));
+            int32_t s = lrint(fmin(sin(a) * 32768.0, 32767.0));
+
+            for (int i = k; i < N; i += 2 * half)
+            {
+                int16_t* x = &data[2 * i];
+                int16_t* y = &data[2 * (i + half)];
+                int32_t d_re = x[0] - y[0];
+                int32_t d_im = x[1] - y[1];
+
+                // Sum and difference halved, 1/N over all stages.
+                x[0] = (int16_t) ((x[0] + y[0] + 1) >> 1);
+                x[1] = (int16_t) ((x[1] + y[1] + 1) >> 1);
+                y[0] = (int16_t) (((int64_t) d_re * c - (int64_t) d_im * s + (1 << 15)) >> 16);
+                y[1] = (int16_t) (((int64_t) d_re * s + (int64_t) d_im * c + (1 << 15)) >> 16);
+            }
+        }
+    }
+
+    return ESP_OK;
+}
+
+static unsigned int bit_rev(unsigned int i, int N)
+{
+    unsigned int r = 0;
+
+    for (int b = N >> 1; b > 0; b >>= 1, i >>= 1)
+        r = (r << 1) | (i & 1);
+
+    return r;
+}
+
+esp_err_t dsps_bit_rev_sc16_ansi(int16_t* data, int N)
+{
+    for (int i = 0; i < N; i++)
+    {
+        unsigned int j = bit_rev(i, N);
+
+        if (j > (unsigned int) i)
+        {
+            int16_t re = data[2 * i], im = data[2 * i + 1];
+
+            data[2 * i] = data[2 * j];
+            data[2 * i + 1] = data[2 * j + 1];
+            data[2 * j] = re;
+            data[2 * j + 1] = im;
+        }
+    }
+
+    return ESP_OK;
+}
+
+esp_err_t dsps_fft2r_init_fc32(float* fft_table_buff, int table_size)
+{
+    (void) fft_table_buff;
+    (void) table_size;
+    return ESP_OK;
+}
+
+esp_err_t dsps_fft2r_fc32(float* data, int N)
+{
+    for (int half = N / 2; half > 0; half /= 2)
+    {
+        for (int k = 0; k < half; k++)
+        {
+            double a = -2.0 * M_PI * k / (2 * half);
+            float c = (float) cos(a);
+            float s = (float) sin(a);
+
+            for (int i = k; i < N; i += 2 * half)
+            {
+                float* x = &data[2 * i];
+                float* y = &data[2 * (i + half)];
+                float d_re = x[0] - y[0];
+                float d_im = x[1] - y[1];
+
+                x[0] += y[0];
+                x[1] += y[1];
+                y[0] = d_re * c - d_im * s;
+                y[1] = d_re * s + d_im * c;
+            }
+        }
+    }
+
+    return ESP_OK;
+}
+
+esp_err_t dsps_bit_rev_fc32(float* data, int N)
+{
+    for (int i = 0; i < N; i++)
+    {
+        unsigned int j = bit_rev(i, N);
+
+        if (j > (unsigned int) i)
+        {
+            float re = data[2 * i], im = data[2 * i + 1];
+
+            data[2 * i] = data[2 * j];
+            data[2 * i + 1] = data[2 * j + 1];
+            data[2 * j] = re;
+            data[2 * j + 1] = im;
+        }
+    }
+
+    return ESP_OK;
+}
@@ -0,0 +1,59 @@
+#ifndef _HOST_ESP_HEAP_CAPS_H_
+#define _HOST_ESP_HEAP_CAPS_H_
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <malloc.h>
+
+/*
+    Host stand-in for the ESP-IDF heap. Every region is the process heap.
+    Free size is a fixed capacity less the bytes glibc has handed out, so
+    a block kept by anything in the process lowers it as on the target.
+    Largest free block reports the same, fragmentation is not modelled.
+*/
+
+#define MALLOC_CAP_DMA          (1 << 3)
+#define MALLOC_CAP_INTERNAL     (1 << 11)
+#define MALLOC_CAP_SPIRAM       (1 << 10)
+#define MALLOC_CAP_8BIT         (1 << 2)
+#define MALLOC_CAP_DEFAULT      (1 << 12)
+
+#define HOST_HEAP_SIZE          (64u * 1024 * 1024)
+
+static inline void* heap_caps_malloc(size_t size, uint32_t caps)
+{
+    (void) caps;
+    return malloc(size);
+}
+
+static inline void* heap_caps_calloc(size_t n, size_t size, uint32_t caps)
+{
+    (void) caps;
+    return calloc(n, size);
+}
+
+static inline void* heap_caps_aligned_alloc(size_t alignment, size_t size, uint32_t caps)
+{
+    void* ptr;
+
+    (void) caps;
+    return posix_memalign(&ptr, alignment, size) ? NULL : ptr;
+}
+
+static inline void heap_caps_free(void* ptr)
+{
+    free(ptr);
+}
+
+static inline size_t heap_caps_get_free_size(uint32_t caps)
+{
+    (void) caps;
+    return HOST_HEAP_SIZE - mallinfo2().uordblks;
+}
+
+static inline size_t heap_caps_get_largest_free_block(uint32_t caps)
+{
+    return heap_caps_get_free_size(caps);
+}
+
+#endif //_HOST_ESP_HEAP_CAPS_H_
@@ -0,0 +1,4 @@
+#ifndef _HOST_ESP_LOG_H_
+#define _HOST_ESP_LOG_H_
+
+#endif //_HOST_ESP_LOG_H_
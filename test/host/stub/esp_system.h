@@ -0,0 +1,9 @@
+#ifndef _HOST_ESP_SYSTEM_H_
+#define _HOST_ESP_SYSTEM_H_
+
+#include <stdint.h>
+
+/* random(), seed with srandom() for repeatable runs. */
+uint32_t esp_random(void);
+
+#endif //_HOST_ESP_SYSTEM_H_
@@ -0,0 +1,35 @@
+#ifndef _HOST_FREERTOS_H_
+#define _HOST_FREERTOS_H_
+
+#include <stdint.h>
+
+/*
+    Host stand-in for the FreeRTOS subset used by app modules.
+    Ticks are 1 ms and only advance when the test calls host_tick_advance,
+    refer to host_os.c
+*/
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+
+#define pdTRUE                  1
+#define pdFALSE                 0
+#define pdPASS                  pdTRUE
+#define pdFAIL                  pdFALSE
+#define portMAX_DELAY           ((TickType_t) 0xFFFFFFFF)
+#define configTICK_RATE_HZ      1000
+#define portTICK_PERIOD_MS      (1000 / configTICK_RATE_HZ)
+#define pdMS_TO_TICKS(ms)       ((TickType_t) (((uint64_t) (ms) * configTICK_RATE_HZ) / 1000))
+#define pdTICKS_TO_MS(t)        ((TickType_t) (((uint64_t) (t) * 1000) / configTICK_RATE_HZ))
+
+// Critical sections guard against other cores and ISRs, tests using
+// them run on one thread.
+typedef int portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED    0
+#define portENTER_CRITICAL(mux)         ((void) (mux))
+#define portEXIT_CRITICAL(mux)          ((void) (mux))
+
+void host_tick_advance(TickType_t ticks);
+
+#endif //_HOST_FREERTOS_H_
@@ -0,0 +1,14 @@
+#ifndef _HOST_SEMPHR_H_
+#define _HOST_SEMPHR_H_
+
+#include "freertos/FreeRTOS.h"
+
+typedef struct host_sem* SemaphoreHandle_t;
+
+/* pthread mutex, the timeout is ignored. */
+SemaphoreHandle_t xSemaphoreCreateMutex(void);
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem);
+void vSemaphoreDelete(SemaphoreHandle_t sem);
+
+#endif //_HOST_SEMPHR_H_
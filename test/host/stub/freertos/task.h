@@ -0,0 +1,13 @@
+#ifndef _HOST_TASK_H_
+#define _HOST_TASK_H_
+
+#include "freertos/FreeRTOS.h"
+
+typedef void* TaskHandle_t;
+
+TickType_t xTaskGetTickCount(void);
+
+/* Advances the virtual clock, no other task runs meanwhile. */
+void vTaskDelay(TickType_t ticks);
+
+#endif //_HOST_TASK_H_
@@ -0,0 +1,6 @@
+#ifndef _HOST_TIMERS_H_
+#define _HOST_TIMERS_H_
+
+#include "freertos/FreeRTOS.h"
+
+#endif //_HOST_TIMERS_H_
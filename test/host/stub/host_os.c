@@ -0,0 +1,75 @@
+#include <stdlib.h>
+#include <pthread.h>
+#include <time.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_system.h"
+#include "esp_dsp.h"
+
+struct host_sem {
+    pthread_mutex_t mutex;
+};
+
+static TickType_t tick_count;
+
+void host_tick_advance(TickType_t ticks)
+{
+    tick_count += ticks;
+}
+
+TickType_t xTaskGetTickCount(void)
+{
+    return tick_count;
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    host_tick_advance(ticks);
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void)
+{
+    SemaphoreHandle_t sem = malloc(sizeof(*sem));
+
+    if (sem)
+        pthread_mutex_init(&sem->mutex, NULL);
+
+    return sem;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks)
+{
+    (void) ticks;
+    return pthread_mutex_lock(&sem->mutex) == 0 ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem)
+{
+    return pthread_mutex_unlock(&sem->mutex) == 0 ? pdTRUE : pdFALSE;
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t sem)
+{
+    pthread_mutex_destroy(&sem->mutex);
+    free(sem);
+}
+
+uint32_t esp_random(void)
+{
+    return ((uint32_t) random() << 16) ^ (uint32_t) random();
+}
+
+uint64_t host_cycle_count(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __builtin_ia32_rdtsc();
+#else
+    struct timespec ts;
+
+    // Nanoseconds where no cycle counter is readable.
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000u + ts.tv_nsec;
+#endif
+}
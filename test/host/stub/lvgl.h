@@ -0,0 +1,74 @@
+#ifndef _HOST_LVGL_H_
+#define _HOST_LVGL_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+    LVGL calls used by main/ui.c. Objects are dummies, nothing is drawn.
+    Last text set on any label is kept in host_lv_last_text.
+*/
+
+typedef struct host_lv_obj lv_obj_t;
+typedef struct { int unused; } lv_style_t;
+typedef struct { int unused; } lv_font_t;
+typedef struct { uint32_t full; } lv_color_t;
+typedef struct host_lv_event lv_event_t;
+typedef void (*lv_event_cb_t)(lv_event_t* e);
+
+typedef enum {
+    LV_EVENT_ALL = 0,
+    LV_EVENT_PRESSED,
+    LV_EVENT_LONG_PRESSED,
+    LV_EVENT_CLICKED,
+    LV_EVENT_VALUE_CHANGED,
+} lv_event_code_t;
+
+typedef enum {
+    LV_ALIGN_TOP_LEFT,
+    LV_ALIGN_TOP_MID,
+    LV_ALIGN_BOTTOM_MID,
+    LV_ALIGN_OUT_BOTTOM_LEFT,
+    LV_ALIGN_OUT_BOTTOM_MID,
+} lv_align_t;
+
+#define LV_STATE_DEFAULT        0x0000
+#define LV_STATE_FOCUSED        0x0002
+#define LV_SYMBOL_VOLUME_MAX    "\xef\x80\xa8"
+
+extern const lv_font_t lv_font_montserrat_12;
+extern const lv_font_t lv_font_montserrat_14;
+extern const lv_font_t lv_font_montserrat_18;
+extern const lv_font_t lv_font_montserrat_20;
+extern const lv_font_t lv_font_montserrat_24;
+
+extern char host_lv_last_text[512];
+
+lv_obj_t* lv_scr_act(void);
+void lv_scr_load(lv_obj_t* scr);
+lv_obj_t* lv_obj_create(lv_obj_t* parent);
+void lv_obj_del(lv_obj_t* obj);
+lv_obj_t* lv_label_create(lv_obj_t* parent);
+lv_obj_t* lv_btn_create(lv_obj_t* parent);
+
+void lv_label_set_text(lv_obj_t* obj, const char* text);
+void lv_label_set_text_static(lv_obj_t* obj, const char* text);
+void lv_label_set_text_fmt(lv_obj_t* obj, const char* fmt, ...);
+void lv_label_set_recolor(lv_obj_t* obj, bool en);
+
+void lv_obj_align(lv_obj_t* obj, lv_align_t align, int x, int y);
+void lv_obj_align_to(lv_obj_t* obj, const lv_obj_t* base, lv_align_t align, int x, int y);
+void lv_obj_center(lv_obj_t* obj);
+void lv_obj_invalidate(const lv_obj_t* obj);
+void lv_obj_set_style_text_font(lv_obj_t* obj, const lv_font_t* font, uint32_t selector);
+void lv_obj_add_style(lv_obj_t* obj, lv_style_t* style, uint32_t selector);
+void lv_obj_add_event_cb(lv_obj_t* obj, lv_event_cb_t cb, lv_event_code_t filter, void* user_data);
+lv_event_code_t lv_event_get_code(lv_event_t* e);
+
+void lv_style_init(lv_style_t* style);
+void lv_style_set_bg_color(lv_style_t* style, lv_color_t color);
+void lv_style_set_min_width(lv_style_t* style, int value);
+void lv_style_set_min_height(lv_style_t* style, int value);
+lv_color_t lv_color_hex(uint32_t c);
+
+#endif //_HOST_LVGL_H_
@@ -0,0 +1,61 @@
+#include <stdio.h>
+#include <stdarg.h>
+#include <stdlib.h>
+
+#include "lvgl.h"
+
+struct host_lv_obj {
+    int unused;
+};
+
+const lv_font_t lv_font_montserrat_12;
+const lv_font_t lv_font_montserrat_14;
+const lv_font_t lv_font_montserrat_18;
+const lv_font_t lv_font_montserrat_20;
+const lv_font_t lv_font_montserrat_24;
+
+char host_lv_last_text[512];
+
+static lv_obj_t screen;
+
+lv_obj_t* lv_scr_act(void) { return &screen; }
+void lv_scr_load(lv_obj_t* scr) { (void) scr; }
+lv_obj_t* lv_obj_create(lv_obj_t* parent) { return calloc(1, sizeof(lv_obj_t)); }
+void lv_obj_del(lv_obj_t* obj) { if (obj != &screen) free(obj); }
+lv_obj_t* lv_label_create(lv_obj_t* parent) { return calloc(1, sizeof(lv_obj_t)); }
+lv_obj_t* lv_btn_create(lv_obj_t* parent) { return calloc(1, sizeof(lv_obj_t)); }
+
+void lv_label_set_text(lv_obj_t* obj, const char* text)
+{
+    snprintf(host_lv_last_text, sizeof(host_lv_last_text), "%s", text);
+}
+
+void lv_label_set_text_static(lv_obj_t* obj, const char* text)
+{
+    lv_label_set_text(obj, text);
+}
+
+void lv_label_set_text_fmt(lv_obj_t* obj, const char* fmt, ...)
+{
+    va_list ap;
+
+    va_start(ap, fmt);
+    vsnprintf(host_lv_last_text, sizeof(host_lv_last_text), fmt, ap);
+    va_end(ap);
+}
+
+void lv_label_set_recolor(lv_obj_t* obj, bool en) { }
+void lv_obj_align(lv_obj_t* obj, lv_align_t align, int x, int y) { }
+void lv_obj_align_to(lv_obj_t* obj, const lv_obj_t* base, lv_align_t align, int x, int y) { }
+void lv_obj_center(lv_obj_t* obj) { }
+void lv_obj_invalidate(const lv_obj_t* obj) { }
+void lv_obj_set_style_text_font(lv_obj_t* obj, const lv_font_t* font, uint32_t selector) { }
+void lv_obj_add_style(lv_obj_t* obj, lv_style_t* style, uint32_t selector) { }
+void lv_obj_add_event_cb(lv_obj_t* obj, lv_event_cb_t cb, lv_event_code_t filter, void* user_data) { }
+lv_event_code_t lv_event_get_code(lv_event_t* e) { return LV_EVENT_ALL; }
+
+void lv_style_init(lv_style_t* style) { }
+void lv_style_set_bg_color(lv_style_t* style, lv_color_t color) { }
+void lv_style_set_min_width(lv_style_t* style, int value) { }
+void lv_style_set_min_height(lv_style_t* style, int value) { }
+lv_color_t lv_color_hex(uint32_t c) { lv_color_t col = { c }; return col; }
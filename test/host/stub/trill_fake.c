@@ -0,0 +1,248 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "trill.h"
+#include "trill_error.h"
+#include "app_config.h"
+#include "trill_fake.h"
+
+#define N_TABLES        3
+#define TABLE_SIZE      4096
+#define TABLE_ALIGN     8
+#define N_DSP_BUFS      2
+#define DSP_BUF_SIZE    2048
+#define LEAK_SIZE       256
+#define PACKET_BLOCKS   16
+#define N_EXTRA         (APP_SDK_MEM_MAX_BLOCKS + 32)
+#define EXTRA_SIZE      32
+
+typedef struct {
+    trill_init_opts_t opts;
+    void* tables[N_TABLES];
+    void* dsp[N_DSP_BUFS];
+    unsigned char* rx_ring;
+    unsigned char* tx_ring;
+    unsigned int rx_wr;
+    void* extra[N_EXTRA];
+    unsigned char* packet;      // pending TX
+    unsigned int tx_left;       // blocks of pending TX not yet modulated
+    unsigned int tx_ready;      // modulated, not yet acquired
+    int tx_on;
+} fake_t;
+
+static trill_fake_fault_t fault;
+static void* volatile lost;
+
+void trill_fake_set_fault(trill_fake_fault_t f)
+{
+    fault = f;
+}
+
+static void release(fake_t* f)
+{
+    const trill_init_opts_t* o = &f->opts;
+
+    for (int i = 0; i < N_TABLES; i++)
+        if (f->tables[i])
+            o->mem_free_fn(f->tables[i]);
+
+    for (int i = 0; i < N_DSP_BUFS; i++)
+        if (f->dsp[i])
+            o->mem_free_fn(f->dsp[i]);
+
+    if (f->rx_ring)
+        o->mem_free_fn(f->rx_ring);
+    if (f->tx_ring)
+        o->mem_free_fn(f->tx_ring);
+    if (f->packet)
+        o->mem_free_fn(f->packet);
+
+    for (int i = 0; i < N_EXTRA; i++)
+        if (f->extra[i])
+            o->mem_free_fn(f->extra[i]);
+
+    o->mem_free_fn(f);
+}
+
+int trill_init(const trill_init_opts_t* init_opt, void** handle)
+{
+    const trill_init_opts_t* o = init_opt;
+    fake_t* f;
+
+    if (!o || !handle || !o->mem_alloc_fn || !o->mem_aligned_alloc_fn || !o->mem_free_fn)
+        return TRILL_ERR_INVALID_PARAMETERS;
+
+    if (!o->b64_license || !o->b64_license[0])
+        return TRILL_ERR_INVALID_LICENSE_DATA;
+
+    f = o->mem_alloc_fn(sizeof(*f));
+    if (!f)
+        return TRILL_ERR_OUT_OF_MEMORY;
+    memset(f, 0, sizeof(*f));
+    f->opts = *o;
+
+    for (int i = 0; i < N_TABLES; i++)
+        f->tables[i] = o->mem_aligned_alloc_fn(TABLE_ALIGN, TABLE_SIZE);
+
+    for (int i = 0; i < N_DSP_BUFS; i++)
+        f->dsp[i] = o->mem_aligned_alloc_fn(16, DSP_BUF_SIZE);
+
+    f->rx_ring = o->mem_alloc_fn(o->aud_buf_rx_block_size_bytes * o->aud_buf_rx_n_blocks);
+    f->tx_ring = o->mem_alloc_fn(o->aud_buf_tx_block_size_bytes * o->aud_buf_tx_n_blocks);
+
+    for (int i = 0; i < N_TABLES; i++)
+    {
+        if (!f->tables[i])
+            goto nomem;
+        memset(f->tables[i], i + 1, TABLE_SIZE);
+    }
+    for (int i = 0; i < N_DSP_BUFS; i++)
+        if (!f->dsp[i])
+            goto nomem;
+    if (!f->rx_ring || !f->tx_ring)
+        goto nomem;
+
+    if (fault == TRILL_FAKE_MANY_BLOCKS)
+    {
+        for (int i = 0; i < N_EXTRA; i++)
+        {
+            f->extra[i] = o->mem_alloc_fn(EXTRA_SIZE);
+            if (!f->extra[i])
+                goto nomem;
+        }
+    }
+
+    if (fault == TRILL_FAKE_LEAK_HEAP)
+    {
+        // Lost on purpose, as a platform call inside the SDK would. Last
+        // one is kept so the compiler cannot drop the malloc.
+        lost = malloc(LEAK_SIZE);
+    }
+
+    *handle = f;
+    return 0;
+
+nomem:
+    release(f);
+    return TRILL_ERR_OUT_OF_MEMORY;
+}
+
+int trill_deinit(void* handle)
+{
+    fake_t* f = handle;
+
+    if (!f)
+        return TRILL_ERR_INVALID_PARAMETERS;
+
+    if (fault == TRILL_FAKE_LEAK_SDK)
+        f->tables[N_TABLES - 1] = NULL;
+
+    release(f);
+    return 0;
+}
+
+int trill_add_audio_block(void* handle, const void* block)
+{
+    fake_t* f = handle;
+    unsigned int size = f->opts.aud_buf_rx_block_size_bytes;
+
+    memcpy(f->rx_ring + f->rx_wr * size, block, size);
+    f->rx_wr = (f->rx_wr + 1) % f->opts.aud_buf_rx_n_blocks;
+    return 0;
+}
+
+int trill_process(void* handle)
+{
+    fake_t* f = handle;
+
+    if (!f->packet)
+        return TRILL_PROC_CTS_SEARCH;
+
+    if (f->tx_left && (f->tx_ready < f->opts.aud_buf_tx_n_blocks))
+    {
+        f->tx_left--;
+        f->tx_ready++;
+        return TRILL_PROC_DEMOD_PROGRESS;
+    }
+
+    if (!f->tx_left && !f->tx_ready)
+    {
+        trill_data_link_event_params_t params = {
+            .event = TRILL_DATA_LINK_EVT_DATA_SENT,
+            .user_data = f->opts.data_link_cb_user_data,
+        };
+
+        f->opts.mem_free_fn(f->packet);
+        f->packet = NULL;
+        f->tx_on = 0;
+        if (f->opts.audio_tx_enable_fn)
+            f->opts.audio_tx_enable_fn(0);
+        if (f->opts.data_link_cb)
+            f->opts.data_link_cb(&params);
+        return TRILL_PROC_MOD_PACKET_SENT;
+    }
+
+    return TRILL_PROC_DEMOD_PROGRESS;
+}
+
+int trill_tx_data(void* handle, trill_tx_params_t* security_params,
+    unsigned char* data, unsigned int data_len)
+{
+    fake_t* f = handle;
+
+    (void) security_params;
+
+    if (f->packet)
+        return TRILL_ERR_AUDIO_TX_BLOCK_NOT_AVAILABLE;
+
+    f->packet = f->opts.mem_alloc_fn(data_len + 1);
+    if (!f->packet)
+        return TRILL_ERR_OUT_OF_MEMORY;
+    memcpy(f->packet, data, data_len);
+
+    f->tx_left = PACKET_BLOCKS;
+    f->tx_ready = 0;
+    f->tx_on = 1;
+    if (f->opts.audio_tx_enable_fn)
+        f->opts.audio_tx_enable_fn(1);
+    return 0;
+}
+
+int trill_acquire_audio_block(void* handle, short** addr, int en_blocking)
+{
+    fake_t* f = handle;
+
+    (void) en_blocking;
+
+    if (!f->tx_ready)
+        return TRILL_ERR_AUDIO_TX_BLOCK_NOT_AVAILABLE;
+
+    *addr = (short*) f->tx_ring;
+    return 0;
+}
+
+int trill_release_audio_block(void* handle)
+{
+    fake_t* f = handle;
+
+    if (f->tx_ready)
+        f->tx_ready--;
+    return 0;
+}
+
+int trill_tx_abort(void* handle)
+{
+    fake_t* f = handle;
+
+    if (f->packet)
+    {
+        f->opts.mem_free_fn(f->packet);
+        f->packet = NULL;
+    }
+    f->tx_left = 0;
+    f->tx_ready = 0;
+    if (f->tx_on && f->opts.audio_tx_enable_fn)
+        f->opts.audio_tx_enable_fn(0);
+    f->tx_on = 0;
+    return 0;
+}
@@ -0,0 +1,22 @@
+#ifndef _HOST_TRILL_FAKE_H_
+#define _HOST_TRILL_FAKE_H_
+
+/*
+    Host stand-in for libtrill_core_sdk.a, for tests of the app code
+    around it. Nothing is modulated or demodulated. Allocations follow
+    the SDK's shape through the init option callbacks: state, tables,
+    16 byte aligned DSP buffers, RX and TX rings, and a packet buffer
+    from trill_tx_data to abort or sent.
+*/
+
+typedef enum {
+    TRILL_FAKE_OK = 0,
+    TRILL_FAKE_LEAK_SDK,    // deinit keeps a block from mem_alloc_fn
+    TRILL_FAKE_LEAK_HEAP,   // init mallocs outside the hooks, never freed
+    TRILL_FAKE_MANY_BLOCKS, // more blocks than sdk_mem tracks, all freed
+} trill_fake_fault_t;
+
+/* From the next trill_init on. */
+void trill_fake_set_fault(trill_fake_fault_t fault);
+
+#endif //_HOST_TRILL_FAKE_H_
@@ -0,0 +1,220 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+
+#include "lvgl.h"
+#include "trill.h"
+#include "rx_pool.h"
+#include "ui.h"
+
+/*
+    Flood of the lock-free UI event path.
+
+    A producer thread takes buffers from the RX pool and posts them with
+    ui_post_rx_buf as fast as the pool allows, with ui_post_en_echo in
+    between. The main thread runs ui_process_events like the LVGL loop.
+    Checked: every shown buffer is newer than the one before (nothing
+    applied twice or out of order), the last posted one is shown, the
+    message counter equals the number of posts (coalesced ones counted
+    once), the last echo request wins and the pool holds only the shown
+    buffer afterwards (every dropped buffer released exactly once).
+*/
+
+#define POOL_WAIT_MAX   1000000
+
+int ui_host_echo_enabled(void);
+
+static unsigned int n_posts = 1000000;
+static int verbose;
+static atomic_int producer_done;
+static atomic_int last_echo;
+static unsigned int n_pool_waits;
+static unsigned int n_posted;
+static unsigned int n_coalesce_logs;
+
+int ui_host_log(const char* fmt, ...)
+{
+    va_list ap;
+    int n = 0;
+
+    if (strstr(fmt, "coalesced"))
+        n_coalesce_logs++;
+
+    if (verbose)
+    {
+        va_start(ap, fmt);
+        n = vprintf(fmt, ap);
+        va_end(ap);
+    }
+
+    return n;
+}
+
+void link_quality_on_rx(const trill_data_link_event_params_t* params,
+        link_rx_metrics_t* metrics)
+{
+    memset(metrics, 0, sizeof(*metrics));
+}
+
+static void* producer(void* arg)
+{
+    trill_data_link_event_params_t params;
+    char payload[16];
+    rx_buf_t* buf;
+    unsigned int seed = 1;
+
+    memset(&params, 0, sizeof(params));
+    params.event = TRILL_DATA_LINK_EVT_DATA_RCVD;
+    params.payload = (unsigned char*) payload;
+
+    for (unsigned int seq = 1; seq <= n_posts; seq++)
+    {
+        params.payload_len = snprintf(payload, sizeof(payload), "%u", seq);
+
+        // Pool holds the pending and the shown buffer, wait for the UI.
+        // A leaked buffer would keep it empty for good.
+        for (unsigned int wait = 0; (buf = rx_buf_from_event(&params)) == NULL; wait++)
+        {
+            if (wait == POOL_WAIT_MAX)
+            {
+                atomic_store(&producer_done, 1);
+                return NULL;
+            }
+            n_pool_waits++;
+            sched_yield();
+        }
+        ui_post_rx_buf(buf);
+        n_posted = seq;
+
+        if ((seq % 3) == 0)
+        {
+            int en = (seq / 3) & 1;
+            atomic_store(&last_echo, en);
+            ui_post_en_echo(en);
+        }
+
+        // Vary how many posts land between two UI passes, down to none.
+        if ((rand_r(&seed) % 8) == 0)
+            sched_yield();
+    }
+
+    atomic_store(&producer_done, 1);
+    return NULL;
+}
+
+static unsigned int shown_seq(void)
+{
+    const rx_buf_t* buf = ui_get_shown_rx_buf();
+    char txt[16];
+
+    if ((buf == NULL) || (buf->len >= sizeof(txt)))
+        return 0;
+
+    memcpy(txt, buf->data, buf->len);
+    txt[buf->len] = '\0';
+    return strtoul(txt, NULL, 10);
+}
+
+int main(int argc, char** argv)
+{
+    pthread_t thread;
+    unsigned int last = 0;
+    unsigned int n_applied = 0;
+    unsigned int n_bad = 0;
+    int count = -1;
+    int fail = 0;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "n:vh")) != -1)
+    {
+        switch (opt)
+        {
+            case 'n': n_posts = strtoul(optarg, NULL, 10); break;
+            case 'v': verbose = 1; break;
+            default:
+                printf("usage: %s [-n posts] [-v]\n"
+                       "  -n  buffers posted, default 1000000\n"
+                       "  -v  print UI console output\n", argv[0]);
+                return 2;
+        }
+    }
+
+    ui_start();
+    pthread_create(&thread, NULL, producer, NULL);
+
+    while (1)
+    {
+        int done = atomic_load(&producer_done);
+
+        // After done was seen one more pass picks up the last post.
+        if (ui_process_events())
+        {
+            unsigned int seq = shown_seq();
+
+            if (seq <= last)
+            {
+                if (n_bad++ < 10)
+                    printf("shown %u after %u\n", seq, last);
+            }
+            last = seq;
+            n_applied++;
+        }
+        else
+        {
+            sched_yield();
+        }
+
+        if (done)
+            break;
+    }
+
+    pthread_join(thread, NULL);
+
+    if (n_posted != n_posts)
+    {
+        printf("FAIL: RX pool empty after %u posts, buffers leaked\n", n_posted);
+        return 1;
+    }
+
+    sscanf(host_lv_last_text, "#0000ff %d)", &count);
+
+    printf("ui flood: %u posted, %u applied, %u coalesce reports, %u pool waits, "
+           "%u pool exhausted\n", n_posts, n_applied, n_coalesce_logs, n_pool_waits,
+           rx_pool_exhausted_count());
+
+    if (n_bad)
+    {
+        printf("FAIL: %u buffers shown twice or out of order\n", n_bad);
+        fail = 1;
+    }
+    if (last != n_posts)
+    {
+        printf("FAIL: last shown %u, last posted %u\n", last, n_posts);
+        fail = 1;
+    }
+    if (count != (int) n_posts)
+    {
+        printf("FAIL: message counter %d, posted %u\n", count, n_posts);
+        fail = 1;
+    }
+    if (ui_host_echo_enabled() != atomic_load(&last_echo))
+    {
+        printf("FAIL: echo %d, last request %d\n", ui_host_echo_enabled(),
+            atomic_load(&last_echo));
+        fail = 1;
+    }
+    if (rx_pool_in_use() != 1)
+    {
+        printf("FAIL: %u pool buffers held, only the shown one expected\n",
+            rx_pool_in_use());
+        fail = 1;
+    }
+
+    printf("%s\n", fail ? "FAIL" : "PASS");
+    return fail;
+}
@@ -0,0 +1,16 @@
+/*
+    main/ui.c with its console output routed to the test, plus read
+    access to the echo button state.
+*/
+
+#include <stdio.h>
+
+int ui_host_log(const char* fmt, ...);
+#define printf(...)             ui_host_log(__VA_ARGS__)
+
+#include "../../main/ui.c"
+
+int ui_host_echo_enabled(void)
+{
+    return allow_echo;
+}
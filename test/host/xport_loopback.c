@@ -0,0 +1,444 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <unistd.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "trill.h"
+#include "app_config.h"
+#include "transport.h"
+
+/*
+    Two transport instances talking over a simulated room channel.
+
+    Node A sends random messages of 1..XPORT_MAX_MSG_LEN bytes to node B,
+    B answers with ACKs. Each node airs its queued packets one after
+    another with APP_TX_GUARD_MS between them, like tx_queue. A burst
+    starts once the peer was quiet for APP_LBT_IFS_MS plus a random
+    backoff of APP_LBT_SLOT_MS slots, like lbt_acquire, or at once with
+    -b. A packet is lost with the given probability, or when both nodes
+    are on air at the same time. Every loss level runs once with XOR
+    parity FEC (APP_XPORT_FEC_GROUP) and once with selective repeat only.
+
+    Reported per run: messages delivered, packets aired per fragment
+    (cost), mean time per message and goodput. Exit status is non-zero
+    when a message arrives corrupted or twice, or is not delivered
+    without loss.
+*/
+
+#define STEP_MS             10
+#define MSG_TIMEOUT_MS      (30 * 60 * 1000)
+
+#define NODE_API(n) \
+    int n##_xport_init(xport_rx_cb_t rx_cb, xport_tx_done_cb_t tx_done_cb); \
+    int n##_xport_send(const trill_tx_params_t* params, const uint8_t* msg, unsigned int len); \
+    int n##_xport_on_rx(const uint8_t* pkt, unsigned int len); \
+    void n##_xport_poll(void);
+
+NODE_API(fec_a)
+NODE_API(fec_b)
+NODE_API(arq_a)
+NODE_API(arq_b)
+
+typedef struct {
+    uint8_t data[TRILL_MAX_DATA_PAYLOAD_LEN];
+    unsigned int len;
+} sim_pkt_t;
+
+typedef struct node {
+    // TX queue: one packet on air, APP_TX_QUEUE_DEPTH waiting.
+    sim_pkt_t queue[APP_TX_QUEUE_DEPTH];
+    unsigned int head;
+    unsigned int count;
+    sim_pkt_t air;
+    int on_air;
+    int in_burst;
+    int collided;
+    TickType_t air_end;
+    TickType_t next_start;
+    TickType_t backoff;
+    struct node* peer;
+    int (*on_rx)(const uint8_t* pkt, unsigned int len);
+    unsigned int n_aired;
+} node_t;
+
+typedef struct {
+    const char* name;
+    int (*init)(xport_rx_cb_t, xport_tx_done_cb_t);
+    int (*send)(const trill_tx_params_t*, const uint8_t*, unsigned int);
+    int (*on_rx)(const uint8_t*, unsigned int);
+    void (*poll)(void);
+} xport_api_t;
+
+static const xport_api_t api[2][2] = {
+    {
+        {"fec", fec_a_xport_init, fec_a_xport_send, fec_a_xport_on_rx, fec_a_xport_poll},
+        {"fec", fec_b_xport_init, fec_b_xport_send, fec_b_xport_on_rx, fec_b_xport_poll},
+    },
+    {
+        {"arq", arq_a_xport_init, arq_a_xport_send, arq_a_xport_on_rx, arq_a_xport_poll},
+        {"arq", arq_b_xport_init, arq_b_xport_send, arq_b_xport_on_rx, arq_b_xport_poll},
+    },
+};
+
+static node_t node_a;
+static node_t node_b;
+static double loss;
+static unsigned int airtime_ms = 2000;
+static unsigned int preamble_ms = 600;
+static int blind;
+static int verbose;
+
+static uint8_t msg[XPORT_MAX_MSG_LEN];
+static unsigned int msg_len;
+static unsigned int n_rx_ok;
+static unsigned int n_rx_bad;
+static unsigned int n_overflows;    // sends on a full queue
+static int tx_done;
+static int tx_result;
+
+int xport_sim_log(const char* fmt, ...)
+{
+    va_list ap;
+    int n = 0;
+
+    if (verbose)
+    {
+        va_start(ap, fmt);
+        n = vprintf(fmt, ap);
+        va_end(ap);
+    }
+
+    return n;
+}
+
+static int node_send(node_t* n, const unsigned char* data, unsigned int len)
+{
+    sim_pkt_t* p;
+
+    if (len > TRILL_MAX_DATA_PAYLOAD_LEN)
+        return -1;
+
+    // Firmware prints each one, transport must check space first.
+    if (n->count == APP_TX_QUEUE_DEPTH)
+    {
+        n_overflows++;
+        return -1;
+    }
+
+    p = &n->queue[(n->head + n->count) % APP_TX_QUEUE_DEPTH];
+    memcpy(p->data, data, len);
+    p->len = len;
+    n->count++;
+
+    if (!n->in_burst && !n->on_air && (n->count == 1))
+        n->backoff = pdMS_TO_TICKS((random() % APP_LBT_CW_MIN) * APP_LBT_SLOT_MS);
+
+    return 0;
+}
+
+static int node_in_burst(node_t* n)
+{
+    return n->on_air || n->count;
+}
+
+int fec_a_tx_queue_send(const trill_tx_params_t* params,
+        const unsigned char* data, unsigned int data_len, unsigned int* id)
+{
+    return node_send(&node_a, data, data_len);
+}
+
+int fec_b_tx_queue_send(const trill_tx_params_t* params,
+        const unsigned char* data, unsigned int data_len, unsigned int* id)
+{
+    return node_send(&node_b, data, data_len);
+}
+
+int arq_a_tx_queue_send(const trill_tx_params_t* params,
+        const unsigned char* data, unsigned int data_len, unsigned int* id)
+{
+    return node_send(&node_a, data, data_len);
+}
+
+int arq_b_tx_queue_send(const trill_tx_params_t* params,
+        const unsigned char* data, unsigned int data_len, unsigned int* id)
+{
+    return node_send(&node_b, data, data_len);
+}
+
+static unsigned int node_space(const node_t* n)
+{
+    return APP_TX_QUEUE_DEPTH - n->count;
+}
+
+unsigned int fec_a_tx_queue_space(void) { return node_space(&node_a); }
+unsigned int fec_b_tx_queue_space(void) { return node_space(&node_b); }
+unsigned int arq_a_tx_queue_space(void) { return node_space(&node_a); }
+unsigned int arq_b_tx_queue_space(void) { return node_space(&node_b); }
+
+int fec_a_tx_queue_in_burst(void) { return node_in_burst(&node_a); }
+int fec_b_tx_queue_in_burst(void) { return node_in_burst(&node_b); }
+int arq_a_tx_queue_in_burst(void) { return node_in_burst(&node_a); }
+int arq_b_tx_queue_in_burst(void) { return node_in_burst(&node_b); }
+
+static unsigned int packet_airtime(unsigned int len)
+{
+    return preamble_ms + ((airtime_ms - preamble_ms) * len) / TRILL_MAX_DATA_PAYLOAD_LEN;
+}
+
+/* Peer quiet long enough for the first packet of a burst. */
+static int channel_clear(const node_t* n, TickType_t now)
+{
+    const node_t* peer = n->peer;
+
+    if (blind)
+        return 1;
+
+    return !peer->on_air && (!peer->n_aired ||
+        ((now - peer->air_end) >= (pdMS_TO_TICKS(APP_LBT_IFS_MS) + n->backoff)));
+}
+
+static void node_step(node_t* n, TickType_t now)
+{
+    if (n->on_air && ((int32_t) (now - n->air_end) >= 0))
+    {
+        n->on_air = 0;
+        if (!n->collided && ((double) random() / RAND_MAX >= loss))
+            n->on_rx(n->air.data, n->air.len);
+
+        // Next packet of the burst after the guard gap.
+        n->in_burst = (n->count > 0);
+        n->next_start = now + pdMS_TO_TICKS(APP_TX_GUARD_MS);
+    }
+
+    if (!n->on_air && n->count && ((int32_t) (now - n->next_start) >= 0) &&
+        (n->in_burst || channel_clear(n, now)))
+    {
+        n->air = n->queue[n->head];
+        n->head = (n->head + 1) % APP_TX_QUEUE_DEPTH;
+        n->count--;
+        n->on_air = 1;
+        n->collided = 0;
+        n->air_end = now + pdMS_TO_TICKS(packet_airtime(n->air.len));
+        n->n_aired++;
+
+        // Any overlap loses both packets.
+        if (n->peer->on_air)
+        {
+            n->collided = 1;
+            n->peer->collided = 1;
+        }
+    }
+}
+
+static void on_msg(const uint8_t* data, unsigned int len)
+{
+    if ((len == msg_len) && (memcmp(data, msg, len) == 0) && !tx_done)
+        n_rx_ok++;
+    else
+        n_rx_bad++;
+}
+
+static void on_tx_done(int result)
+{
+    tx_done = 1;
+    tx_result = result;
+}
+
+typedef struct {
+    unsigned int n_msgs;
+    unsigned int n_ok;
+    unsigned int n_frags;
+    unsigned int n_aired;
+    unsigned int n_acks;
+    unsigned long long bytes;
+    unsigned long long ms;
+} run_stats_t;
+
+/* Returns number of messages received corrupted or more than once. */
+static unsigned int run(const xport_api_t* a, const xport_api_t* b,
+        unsigned int n_msgs, run_stats_t* st)
+{
+    trill_tx_params_t params = {0};
+    unsigned int n_bad = 0;
+
+    memset(st, 0, sizeof(*st));
+    memset(&node_a, 0, sizeof(node_a));
+    memset(&node_b, 0, sizeof(node_b));
+    node_a.peer = &node_b;
+    node_a.on_rx = b->on_rx;
+    node_b.peer = &node_a;
+    node_b.on_rx = a->on_rx;
+
+    a->init(NULL, on_tx_done);
+    b->init(on_msg, NULL);
+    params.ssi = SSI_PLAIN_TEXT;
+    params.data_cfg_range = TRILL_DATA_CFG_RANGE_FAR;
+
+    for (unsigned int m = 0; m < n_msgs; m++)
+    {
+        TickType_t start = xTaskGetTickCount();
+        TickType_t now = start;
+
+        msg_len = 1 + random() % XPORT_MAX_MSG_LEN;
+        for (unsigned int i = 0; i < msg_len; i++)
+            msg[i] = random();
+
+        n_rx_ok = 0;
+        n_rx_bad = 0;
+        tx_done = 0;
+        if (a->send(&params, msg, msg_len) < 0)
+        {
+            printf("send %u refused\n", m);
+            return n_bad + 1;
+        }
+
+        // Until reported and both nodes went quiet, receiver's last ACK included.
+        while (!tx_done || node_in_burst(&node_a) || node_in_burst(&node_b))
+        {
+            a->poll();
+            b->poll();
+            node_step(&node_a, now);
+            node_step(&node_b, now);
+
+            host_tick_advance(pdMS_TO_TICKS(STEP_MS));
+            now = xTaskGetTickCount();
+
+            if ((now - start) > pdMS_TO_TICKS(MSG_TIMEOUT_MS))
+            {
+                printf("message %u never reported\n", m);
+                return n_bad + 1;
+            }
+        }
+
+        st->n_msgs++;
+        st->n_frags += (msg_len + XPORT_FRAG_DATA_LEN - 1) / XPORT_FRAG_DATA_LEN;
+        st->ms += pdTICKS_TO_MS(now - start);
+
+        if ((tx_result == 0) && (n_rx_ok == 1))
+        {
+            st->n_ok++;
+            st->bytes += msg_len;
+        }
+
+        // Sender saw a result the receiver does not agree with, or data was damaged.
+        if (n_rx_bad || (n_rx_ok > 1) || ((tx_result == 0) && (n_rx_ok == 0)))
+        {
+            printf("message %u: %u bytes, result %d, received %u ok %u bad\n",
+                m, msg_len, tx_result, n_rx_ok, n_rx_bad);
+            n_bad++;
+        }
+
+        // Receiver keeps re-ACKing a repeated last fragment, let idle timers run out.
+        for (unsigned int t = 0; t < APP_XPORT_RX_IDLE_MS; t += STEP_MS)
+        {
+            a->poll();
+            b->poll();
+            node_step(&node_a, xTaskGetTickCount());
+            node_step(&node_b, xTaskGetTickCount());
+            host_tick_advance(pdMS_TO_TICKS(STEP_MS));
+        }
+    }
+
+    st->n_aired = node_a.n_aired;
+    st->n_acks = node_b.n_aired;
+
+    return n_bad;
+}
+
+static void print_stats(const char* name, const run_stats_t* st)
+{
+    printf("  %s  %4u/%-4u %6.1f%%  %5.2f  %5.2f  %7.1f  %6.1f\n",
+        name, st->n_ok, st->n_msgs, 100.0 * st->n_ok / st->n_msgs,
+        (double) st->n_aired / st->n_frags,
+        (double) st->n_acks / st->n_msgs,
+        st->ms / 1000.0 / st->n_msgs,
+        st->ms ? st->bytes * 8000.0 / st->ms : 0.0);
+}
+
+static void usage(const char* prog)
+{
+    printf("usage: %s [-n messages] [-l loss %%] [-a airtime ms] [-p preamble ms] [-s seed] [-b] [-v]\n"
+           "  -n  messages per run, default 200\n"
+           "  -l  single packet loss level, default sweeps 0..40 %%\n"
+           "  -a  airtime of a %u byte packet, default 2000\n"
+           "  -p  airtime of an empty packet, default 600\n"
+           "  -s  random seed, default 1\n"
+           "  -b  blind TX, no listen before talk\n"
+           "  -v  print per message transport reports\n",
+           prog, TRILL_MAX_DATA_PAYLOAD_LEN);
+}
+
+int main(int argc, char** argv)
+{
+    static const double sweep[] = {0, 0.05, 0.10, 0.15, 0.20, 0.30, 0.40};
+    unsigned int n_msgs = 200;
+    unsigned int seed = 1;
+    double single = -1;
+    unsigned int n_bad = 0;
+    int fail = 0;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "n:l:a:p:s:bvh")) != -1)
+    {
+        switch (opt)
+        {
+            case 'n': n_msgs = atoi(optarg); break;
+            case 'l': single = atof(optarg) / 100; break;
+            case 'a': airtime_ms = atoi(optarg); break;
+            case 'p': preamble_ms = atoi(optarg); break;
+            case 's': seed = atoi(optarg); break;
+            case 'b': blind = 1; break;
+            case 'v': verbose = 1; break;
+            default: usage(argv[0]); return 2;
+        }
+    }
+
+    if ((n_msgs == 0) || (preamble_ms > airtime_ms))
+    {
+        usage(argv[0]);
+        return 2;
+    }
+
+    printf("xport loopback: %u messages per run, FEC group %d, %d rounds, "
+           "airtime %u..%u ms, ack timeout %d ms, %s\n",
+        n_msgs, APP_XPORT_FEC_GROUP, APP_XPORT_MAX_ROUNDS,
+        preamble_ms, airtime_ms, APP_XPORT_ACK_TIMEOUT_MS,
+        blind ? "blind TX" : "listen before talk");
+    printf("  mode  delivered         pkt/frag  acks/msg  s/msg  bit/s\n");
+
+    for (unsigned int i = 0; i < sizeof(sweep) / sizeof(sweep[0]); i++)
+    {
+        run_stats_t st;
+
+        loss = (single >= 0) ? single : sweep[i];
+        printf("loss %.0f%%\n", loss * 100);
+
+        for (int mode = 0; mode < 2; mode++)
+        {
+            srandom(seed);
+            n_bad += run(&api[mode][0], &api[mode][1], n_msgs, &st);
+            print_stats(api[mode][0].name, &st);
+
+            if ((loss == 0) && (st.n_ok != st.n_msgs))
+                fail = 1;
+        }
+
+        if (single >= 0)
+            break;
+    }
+
+    if (n_bad)
+        printf("FAIL: %u messages corrupted, duplicated or misreported\n", n_bad);
+    else if (fail)
+        printf("FAIL: messages lost without packet loss\n");
+    else if (n_overflows)
+        printf("FAIL: %u sends on a full TX queue\n", n_overflows);
+    else
+        printf("PASS\n");
+
+    return (n_bad || fail || n_overflows) ? 1 : 0;
+}
@@ -0,0 +1,31 @@
+#ifndef _XPORT_NODE_H_
+#define _XPORT_NODE_H_
+
+/*
+    Builds main/transport.c once per simulated node. XPORT_NODE prefixes
+    every external symbol, the module's statics are private to each
+    translation unit, so every node is an independent instance.
+*/
+
+#include <stdio.h>
+
+#include "app_config.h"
+
+#define XPORT_CAT_(n, s)        n##_##s
+#define XPORT_CAT(n, s)         XPORT_CAT_(n, s)
+
+#define xport_init              XPORT_CAT(XPORT_NODE, xport_init)
+#define xport_reset             XPORT_CAT(XPORT_NODE, xport_reset)
+#define xport_send              XPORT_CAT(XPORT_NODE, xport_send)
+#define xport_on_rx             XPORT_CAT(XPORT_NODE, xport_on_rx)
+#define xport_tx_busy           XPORT_CAT(XPORT_NODE, xport_tx_busy)
+#define xport_poll              XPORT_CAT(XPORT_NODE, xport_poll)
+#define tx_queue_send           XPORT_CAT(XPORT_NODE, tx_queue_send)
+#define tx_queue_in_burst       XPORT_CAT(XPORT_NODE, tx_queue_in_burst)
+#define tx_queue_space          XPORT_CAT(XPORT_NODE, tx_queue_space)
+
+/* Per message reports go to the harness, printed with -v. */
+int xport_sim_log(const char* fmt, ...);
+#define printf(...)             xport_sim_log(__VA_ARGS__)
+
+#endif //_XPORT_NODE_H_
@@ -0,0 +1,8 @@
+#define XPORT_NODE              arq_a
+#include "xport_node.h"
+
+/* Selective repeat only, the baseline FEC is measured against. */
+#undef APP_XPORT_FEC_GROUP
+#define APP_XPORT_FEC_GROUP     0
+
+#include "../../main/transport.c"
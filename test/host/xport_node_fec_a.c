@@ -0,0 +1,4 @@
+#define XPORT_NODE              fec_a
+#include "xport_node.h"
+
+#include "../../main/transport.c"
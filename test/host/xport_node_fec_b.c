@@ -0,0 +1,4 @@
+#define XPORT_NODE              fec_b
+#include "xport_node.h"
+
+#include "../../main/transport.c"